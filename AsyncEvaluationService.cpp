@@ -0,0 +1,175 @@
+/** @file AsyncEvaluationService.cpp
+ * AsyncEvaluationService queues evaluation requests and executes them in batches on a thread pool.
+ * @class AsyncEvaluationService
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "AsyncEvaluationService.h"
+#include <memory>
+
+AsyncEvaluationService::AsyncEvaluationService(size_t threadCount, size_t batchSize)
+    : stopping(false), callbackFailures(0), maxBatchSize(batchSize == 0 ? 1 : batchSize)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0)
+        {
+            threadCount = 1;
+        }
+    }
+
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(&AsyncEvaluationService::workerLoop, this);
+    }
+} // end constructor
+
+AsyncEvaluationService::~AsyncEvaluationService()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+} // end destructor
+
+void AsyncEvaluationService::enqueue(EvaluationRequest&& request)
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingRequests.push_back(std::move(request));
+    }
+    queueReady.notify_one();
+} // end enqueue
+
+void AsyncEvaluationService::workerLoop()
+{
+    InfixToPostfixEvaluation evaluator;  // Each worker owns its evaluator, so evaluation needs no locking
+    std::vector<EvaluationRequest> batch;
+    batch.reserve(maxBatchSize);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this] { return stopping || !pendingRequests.empty(); });
+            if (pendingRequests.empty())
+            {
+                return;  // Stopping and nothing left to do
+            }
+
+            // Take a whole batch per trip so the queue lock is amortized over many requests
+            while (!pendingRequests.empty() && batch.size() < maxBatchSize)
+            {
+                batch.push_back(std::move(pendingRequests.front()));
+                pendingRequests.pop_front();
+            }
+        }
+
+        // Let another worker start on whatever is still queued
+        queueReady.notify_one();
+
+        for (EvaluationRequest& request : batch)
+        {
+            double result = 0;
+            std::exception_ptr error;
+            try
+            {
+                evaluator.setVariableValues(request.variableValues);
+                result = evaluator.evaluateInfixExpression(request.infixExpression);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            // An exception escaping a worker thread would terminate the process, so a throwing callback is contained here
+            try
+            {
+                request.complete(result, error);
+            }
+            catch (...)
+            {
+                callbackFailures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        batch.clear();
+    }
+} // end workerLoop
+
+std::future<double> AsyncEvaluationService::submit(std::string infixExpression, const CompiledExpression::VariableArray& variableValues)
+{
+    auto promise = std::make_shared<std::promise<double>>();
+    std::future<double> future = promise->get_future();
+
+    submit(std::move(infixExpression), variableValues, [promise](double result, std::exception_ptr error)
+        {
+            if (error)
+            {
+                promise->set_exception(error);
+            }
+            else
+            {
+                promise->set_value(result);
+            }
+        });
+    return future;
+} // end submit
+
+void AsyncEvaluationService::submit(std::string infixExpression, const CompiledExpression::VariableArray& variableValues,
+    std::function<void(double, std::exception_ptr)> complete)
+{
+    enqueue(EvaluationRequest{ std::move(infixExpression), variableValues, std::move(complete) });
+} // end submit
+
+std::uint64_t AsyncEvaluationService::getCallbackFailureCount() const noexcept
+{
+    return callbackFailures.load(std::memory_order_relaxed);
+} // end getCallbackFailureCount
+
+#ifdef ASYNC_EVALUATION_COROUTINES
+AsyncEvaluationService::EvaluationAwaitable::EvaluationAwaitable(AsyncEvaluationService& owner, std::string expression,
+    const CompiledExpression::VariableArray& values)
+    : service(owner), infixExpression(std::move(expression)), variableValues(values), result(0)
+{ } // end constructor
+
+bool AsyncEvaluationService::EvaluationAwaitable::await_ready() const noexcept
+{
+    return false;
+} // end await_ready
+
+void AsyncEvaluationService::EvaluationAwaitable::await_suspend(std::coroutine_handle<> awaitingCoroutine)
+{
+    // The awaitable lives in the suspended coroutine frame, so the worker can write the outcome into it
+    service.submit(std::move(infixExpression), variableValues, [this, awaitingCoroutine](double value, std::exception_ptr failure)
+        {
+            result = value;
+            error = failure;
+            awaitingCoroutine.resume();
+        });
+} // end await_suspend
+
+double AsyncEvaluationService::EvaluationAwaitable::await_resume()
+{
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return result;
+} // end await_resume
+
+AsyncEvaluationService::EvaluationAwaitable AsyncEvaluationService::evaluateAsync(std::string infixExpression,
+    const CompiledExpression::VariableArray& variableValues)
+{
+    return EvaluationAwaitable(*this, std::move(infixExpression), variableValues);
+} // end evaluateAsync
+#endif
@@ -0,0 +1,141 @@
+/** @file AsyncEvaluationService.h
+ * @class AsyncEvaluationService
+ * Asynchronous front end for expression evaluation. Callers submit an infix expression with a set of variable values and get back a std::future, or an awaitable when C++20 coroutines are available. Requests are queued and executed in batches on an internal thread pool, each worker using its own InfixToPostfixEvaluation, so submitting threads never evaluate inline.
+ */
+
+#ifndef ASYNC_EVALUATION_SERVICE_
+#define ASYNC_EVALUATION_SERVICE_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "InfixToPostfixEvaluation.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define ASYNC_EVALUATION_COROUTINES 1
+#endif
+
+class AsyncEvaluationService
+{
+private:
+    /** A queued evaluation and the callback that delivers its outcome. */
+    struct EvaluationRequest
+    {
+        std::string infixExpression;
+        CompiledExpression::VariableArray variableValues;
+        std::function<void(double, std::exception_ptr)> complete;
+    };
+
+    /** Requests waiting for a worker. */
+    std::deque<EvaluationRequest> pendingRequests;
+
+    /** Guards pendingRequests and stopping. Held only to push or pop requests. */
+    std::mutex queueMutex;
+
+    /** Signals workers that requests are waiting or the service is stopping. */
+    std::condition_variable queueReady;
+
+    /** True once the destructor has started. */
+    bool stopping;
+
+    /** Number of completion callbacks that threw. */
+    std::atomic<std::uint64_t> callbackFailures;
+
+    /** Largest number of requests a worker takes from the queue at once. */
+    size_t maxBatchSize;
+
+    /** The worker threads. */
+    std::vector<std::thread> workers;
+
+    /** Helper function run by every worker thread.
+     * @pre None
+     * @post Returns once the service is stopping and the queue is empty. */
+    void workerLoop();
+
+    /** Helper function to queue a request and wake a worker.
+     * @pre None
+     * @post The request is queued. */
+    void enqueue(EvaluationRequest&& request);
+
+public:
+    /** Starts the worker threads.
+     * @pre None
+     * @post threadCount workers are waiting for requests.
+     * @param threadCount Number of worker threads. Zero uses the number of hardware threads.
+     * @param batchSize Largest number of requests a worker executes per trip to the queue. */
+    explicit AsyncEvaluationService(size_t threadCount = 0, size_t batchSize = 64);
+
+    /** The service cannot be copied. */
+    AsyncEvaluationService(const AsyncEvaluationService&) = delete;
+
+    /** The service cannot be copied. */
+    AsyncEvaluationService& operator=(const AsyncEvaluationService&) = delete;
+
+    /** Finishes every queued request and stops the worker threads.
+     * @pre No thread is submitting.
+     * @post All futures are ready and all awaiting coroutines have been resumed. */
+    ~AsyncEvaluationService();
+
+    /** Submits an evaluation without waiting for it.
+     * @pre None
+     * @post The request is queued.
+     * @param infixExpression The infix expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @return A future holding the result, or the std::runtime_error evaluation would have thrown. */
+    std::future<double> submit(std::string infixExpression, const CompiledExpression::VariableArray& variableValues);
+
+    /** Submits an evaluation and calls a function with its outcome on a worker thread.
+     * @pre complete does not block for long, it runs on a worker thread. complete should not throw: there is no caller to deliver
+     * the exception to, so the worker discards it, counts it in getCallbackFailureCount, and goes on with the next request.
+     * @post The request is queued.
+     * @param infixExpression The infix expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @param complete Called with the result and a null exception, or with an exception if evaluation failed. */
+    void submit(std::string infixExpression, const CompiledExpression::VariableArray& variableValues,
+        std::function<void(double, std::exception_ptr)> complete);
+
+    /** Retrieves the number of completion callbacks that threw.
+     * @pre None
+     * @post None
+     * @return The number of exceptions caught from callbacks since the service started. */
+    std::uint64_t getCallbackFailureCount() const noexcept;
+
+#ifdef ASYNC_EVALUATION_COROUTINES
+    /** Awaitable returned by evaluateAsync. The awaiting coroutine is resumed on a worker thread. */
+    class EvaluationAwaitable
+    {
+    private:
+        AsyncEvaluationService& service;
+        std::string infixExpression;
+        CompiledExpression::VariableArray variableValues;
+        double result;
+        std::exception_ptr error;
+
+    public:
+        EvaluationAwaitable(AsyncEvaluationService& owner, std::string expression, const CompiledExpression::VariableArray& values);
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> awaitingCoroutine);
+        double await_resume();
+    };
+
+    /** Creates an awaitable evaluation. The request is queued when the awaitable is co_awaited.
+     * @pre None
+     * @post None
+     * @param infixExpression The infix expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @return An awaitable yielding the result, or rethrowing the error evaluation would have thrown. */
+    EvaluationAwaitable evaluateAsync(std::string infixExpression, const CompiledExpression::VariableArray& variableValues);
+#endif
+};
+
+#include "AsyncEvaluationService.cpp"
+#endif
@@ -0,0 +1,98 @@
+/** @file BatchAggregator.cpp
+ * BatchAggregator folds evaluation results into per-thread aggregates and adds per-block sums in block order.
+ * @class BatchAggregator
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "BatchAggregator.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+
+BatchAggregator::BatchAggregator(size_t threads) : threadCount(1)
+{
+    setThreadCount(threads);
+} // end constructor
+
+void BatchAggregator::setThreadCount(size_t threads) noexcept
+{
+    threadCount = threads == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : threads;
+} // end setThreadCount
+
+double BatchAggregator::aggregateBlock(const JitProgram& program, const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY],
+    size_t firstRow, size_t blockRows, double* results, ResultAggregate& aggregate)
+{
+    // Resume after each row that divides by zero until the block is done
+    double blockSum = 0;
+    size_t row = 0;
+    while (row < blockRows)
+    {
+        const std::int32_t* offsetColumns[CompiledExpression::VARIABLE_CAPACITY];
+        for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+        {
+            offsetColumns[variable] = columns[variable] == nullptr ? nullptr : columns[variable] + firstRow + row;
+        }
+        size_t evaluated = program.evaluateColumnsUntilFailure(offsetColumns, results, blockRows - row);
+        aggregate.record(results, evaluated);
+        for (size_t i = 0; i < evaluated; ++i)
+        {
+            blockSum += results[i];
+        }
+        row += evaluated;
+        if (row < blockRows)
+        {
+            aggregate.recordDivisionByZero();
+            ++row;
+        }
+    }
+    return blockSum;
+} // end aggregateBlock
+
+ResultAggregate BatchAggregator::aggregate(const JitProgram& program, const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY],
+    size_t rowCount, const std::vector<double>& bucketBounds) const
+{
+    size_t blockCount = (rowCount + BLOCK_ROWS - 1) / BLOCK_ROWS;
+    size_t workers = std::min(threadCount, blockCount);
+    ResultAggregate total(bucketBounds);
+    std::vector<ResultAggregate> threadAggregates(workers > 1 ? workers - 1 : 0, total);
+    std::vector<double> blockSums(blockCount);
+
+    // Threads take blocks in any order, but each block always adds the same rows into its own sum
+    std::atomic<size_t> nextBlock(0);
+    auto worker = [&](ResultAggregate& threadAggregate)
+        {
+            std::vector<double> results(BLOCK_ROWS);
+            for (size_t block = nextBlock.fetch_add(1); block < blockCount; block = nextBlock.fetch_add(1))
+            {
+                size_t firstRow = block * BLOCK_ROWS;
+                blockSums[block] = aggregateBlock(program, columns, firstRow, std::min(BLOCK_ROWS, rowCount - firstRow),
+                    results.data(), threadAggregate);
+            }
+        };
+
+    std::vector<std::thread> threads;
+    for (ResultAggregate& threadAggregate : threadAggregates)
+    {
+        threads.emplace_back(worker, std::ref(threadAggregate));
+    }
+    worker(total);  // The calling thread folds into the result directly
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    double orderedSum = 0;
+    for (double blockSum : blockSums)
+    {
+        orderedSum += blockSum;
+    }
+    for (const ResultAggregate& threadAggregate : threadAggregates)
+    {
+        total.merge(threadAggregate);
+    }
+    total.replaceSum(orderedSum);
+    return total;
+} // end aggregate
@@ -0,0 +1,59 @@
+/** @file BatchAggregator.h
+ * @class BatchAggregator
+ * Evaluates a program over columnar rows and folds the results straight into a ResultAggregate, so a batch that only needs aggregates never writes one double per row to memory.
+ * Rows are split into fixed blocks of BLOCK_ROWS. Each block is evaluated into a small buffer that stays in cache and folded into the aggregate of the thread that took it, and blocks are shared among threads. Only the sum depends on the order values are added in, so each block also keeps its own sum, and the block sums are added in block order at the end. The result, including the rounding of the sum, is the same for any thread count.
+ */
+
+#ifndef BATCH_AGGREGATOR_
+#define BATCH_AGGREGATOR_
+
+#include <cstdint>
+#include <vector>
+#include "JitProgram.h"
+#include "ResultAggregate.h"
+
+class BatchAggregator
+{
+public:
+    /** Number of rows evaluated and folded at a time. */
+    static constexpr size_t BLOCK_ROWS = 4096;
+
+private:
+    /** Number of threads used for one batch. */
+    size_t threadCount;
+
+    /** Helper function to evaluate and fold one block, counting rows that divide by zero instead of stopping at them.
+     * @pre results has room for blockRows values.
+     * @post aggregate also covers every row of the block.
+     * @return The sum of the block's results, added in row order. */
+    static double aggregateBlock(const JitProgram& program, const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY],
+        size_t firstRow, size_t blockRows, double* results, ResultAggregate& aggregate);
+
+public:
+    /** Creates an aggregator.
+     * @pre None
+     * @post None
+     * @param threads The number of threads per batch. Zero uses the number of hardware threads. */
+    explicit BatchAggregator(size_t threads = 1);
+
+    /** Sets the number of threads per batch.
+     * @pre None
+     * @post Later batches use up to threads threads.
+     * @param threads The thread count. Zero uses the number of hardware threads. */
+    void setThreadCount(size_t threads) noexcept;
+
+    /** Evaluates a program for every row and aggregates the results. Rows that divide by zero are counted and skipped.
+     * @pre columns[v] points to rowCount values of variable v for every variable the expression references.
+     * @post The columns are unchanged.
+     * @param program The program to evaluate.
+     * @param columns One pointer per variable a-f.
+     * @param rowCount The number of rows.
+     * @param bucketBounds Ascending histogram bucket bounds.
+     * @return The aggregates of every row.
+     * @throw std::invalid_argument If the bounds are not strictly ascending. */
+    ResultAggregate aggregate(const JitProgram& program, const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY],
+        size_t rowCount, const std::vector<double>& bucketBounds = {}) const;
+};
+
+#include "BatchAggregator.cpp"
+#endif
@@ -0,0 +1,634 @@
+/** @file Benchmark.cpp
+ * Times expression conversion and evaluation strategies.
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include "InfixToPostfixEvaluation.h"
+#include "ExecutionBackendFactory.h"
+#include "ExpressionBatch.h"
+#include "RegisterProgram.h"
+#include "MultiExpressionEvaluator.h"
+#include "ResultMemo.h"
+#include "BulkConverter.h"
+#include "JitProgram.h"
+#include "ChainProgram.h"
+#include "ResultWriter.h"
+#include "ColumnarVariablesWriter.h"
+#include "MappedFile.h"
+#include "BatchAggregator.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+
+/** Number of times each expression is evaluated per measurement. */
+constexpr int ITERATIONS = 20000;
+
+/** Returns the elapsed time since start in microseconds. */
+double elapsedMicroseconds(chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+}
+
+/** Builds an infix expression with the given number of operands, mixing operators and parentheses. */
+std::string generateExpression(int operandCount)
+{
+	const std::string operators = "+*-+/*";
+	std::string expression;
+	for (int i = 0; i < operandCount; ++i)
+	{
+		if (i > 0)
+		{
+			expression += operators[i % operators.size()];
+		}
+		if (i % 4 == 0 && i + 1 < operandCount)
+		{
+			expression += '(';
+		}
+		expression += static_cast<char>('a' + i % 6);
+		if (i % 4 == 1)
+		{
+			expression += ')';
+		}
+	}
+	return expression;
+}
+
+/** Builds rows of non-zero variable values. */
+std::vector<CompiledExpression::VariableArray> generateRows(size_t rowCount)
+{
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<int> distribution(1, 100);
+	std::vector<CompiledExpression::VariableArray> rows(rowCount);
+	for (CompiledExpression::VariableArray& row : rows)
+	{
+		for (int& value : row)
+		{
+			value = distribution(generator);
+		}
+	}
+	return rows;
+}
+
+int main()
+{
+	InfixToPostfixEvaluation evaluator;
+	evaluator.readValuesFromFile("variables.txt");
+
+	std::string benchmarkExpressions[] =
+	{
+		"a+b*c",
+		"(a+b)*(c-d)",
+		"a+b*c/d-e+f",
+		"a*(b+c)*(d-e)+f",
+		"((a+b)*(c+d)-(e-f))*((a-b)+(c*d)/(e+f))"
+	};
+
+	// One-shot expressions: convert + evaluate versus direct evaluation
+	cout << "=== One-shot evaluation (" << ITERATIONS << " iterations) ===" << endl;
+	double checksum = 0;
+	for (const std::string& infixExpr : benchmarkExpressions)
+	{
+		auto start = chrono::steady_clock::now();
+		for (int i = 0; i < ITERATIONS; ++i)
+		{
+			evaluator.convertInfixToPostfix(infixExpr);
+			checksum += evaluator.evaluatePostfixExpression();
+		}
+		double convertAndEvaluateTime = elapsedMicroseconds(start);
+
+		start = chrono::steady_clock::now();
+		for (int i = 0; i < ITERATIONS; ++i)
+		{
+			checksum += evaluator.evaluateInfixExpression(infixExpr);
+		}
+		double directTime = elapsedMicroseconds(start);
+
+		cout << infixExpr << endl;
+		cout << "  convert + evaluate: " << convertAndEvaluateTime / ITERATIONS << " us/expr" << endl;
+		cout << "  direct:             " << directTime / ITERATIONS << " us/expr" << endl;
+		cout << "  speedup:            " << convertAndEvaluateTime / directTime << "x" << endl;
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// Backend matrix: expression size x batch size x backend
+	cout << "=== Execution backend matrix (ns/row) ===" << endl;
+	const int operandCounts[] = { 4, 16, 64, 256 };
+	const size_t batchSizes[] = { 1, 100, 10000 };
+	const size_t ROWS_PER_MEASUREMENT = 200000;
+	std::vector<ExecutionBackendKind> kinds = ExecutionBackendFactory::getAllKinds();
+
+	cout << "operands  batch";
+	for (ExecutionBackendKind kind : kinds)
+	{
+		cout << "  " << ExecutionBackendFactory::create(kind)->getName();
+	}
+	cout << endl;
+
+	for (int operandCount : operandCounts)
+	{
+		evaluator.convertInfixToPostfix(generateExpression(operandCount));
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+
+		for (size_t batchSize : batchSizes)
+		{
+			std::vector<CompiledExpression::VariableArray> rows = generateRows(batchSize);
+			size_t repetitions = ROWS_PER_MEASUREMENT / batchSize / operandCount + 1;
+
+			cout << operandCount << "  " << batchSize;
+			for (ExecutionBackendKind kind : kinds)
+			{
+				std::shared_ptr<const ExecutionBackendInterface> backend = ExecutionBackendFactory::create(kind);
+				auto start = chrono::steady_clock::now();
+				for (size_t repetition = 0; repetition < repetitions; ++repetition)
+				{
+					for (const CompiledExpression::VariableArray& row : rows)
+					{
+						checksum += backend->execute(compiled, row, std::pmr::get_default_resource());
+					}
+				}
+				double rowTime = elapsedMicroseconds(start) * 1000 / (repetitions * batchSize);
+				cout << "  " << rowTime;
+			}
+			cout << endl;
+		}
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// Many formulas per row that share subexpressions: one bytecode run per formula versus the shared DAG
+	cout << "=== Shared subexpressions across a batch of formulas ===" << endl;
+	const std::string sharedTerms[] = { "(a+b)", "(c*d)", "(e-f)", "(a*c)", "(b+d)", "(a+b)*(c*d)" };
+	const std::string joiningOperators = "+-*";
+	std::vector<CompiledExpression> formulas;
+	ExpressionBatch batch;
+	for (int i = 0; i < 300; ++i)
+	{
+		std::string formula = sharedTerms[i % 6] + joiningOperators[i % 3] + sharedTerms[(i / 6) % 6] +
+			joiningOperators[(i / 3) % 3] + static_cast<char>('a' + i % 6);
+		evaluator.convertInfixToPostfix(formula);
+		formulas.push_back(evaluator.compilePostfixExpression());
+		batch.addFormula(formulas.back().getPostfixExpression());
+	}
+	cout << "Formulas: " << batch.getFormulaCount() << ", operations: " << batch.getTotalOperationCount()
+		<< ", deduplicated: " << batch.getDeduplicatedOperationCount() << endl;
+
+	std::vector<CompiledExpression::VariableArray> batchRows = generateRows(1000);
+	BytecodeBackend bytecodeBackend;
+	auto start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : batchRows)
+	{
+		for (const CompiledExpression& formula : formulas)
+		{
+			checksum += bytecodeBackend.execute(formula, row, std::pmr::get_default_resource());
+		}
+	}
+	double separateTime = elapsedMicroseconds(start);
+
+	std::vector<FormulaResult> batchResults;
+	start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : batchRows)
+	{
+		batch.evaluate(row, batchResults);
+		checksum += batchResults[0].value;
+	}
+	double sharedTime = elapsedMicroseconds(start);
+
+	cout << "  separate bytecode: " << separateTime / batchRows.size() << " us/row" << endl;
+	cout << "  shared DAG:        " << sharedTime / batchRows.size() << " us/row" << endl;
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// Typical 10-30 token formulas: stack bytecode versus the register VM
+	cout << "=== Register VM versus bytecode (ns/row) ===" << endl;
+	const std::string typicalExpressions[] =
+	{
+		"a*b+c*d-e/f",
+		"(a+b)*(c-d)+e*f-a/b",
+		"a*b*c+d*e-f+(a-b)*(c+d)/e",
+		"((a+b)*c-d)/(e+f)+a*b-c*d+e"
+	};
+	std::vector<CompiledExpression::VariableArray> vmRows = generateRows(10000);
+	for (const std::string& infixExpr : typicalExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+		RegisterProgram registerProgram(compiled);
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			for (const CompiledExpression::VariableArray& row : vmRows)
+			{
+				checksum += bytecodeBackend.execute(compiled, row, std::pmr::get_default_resource());
+			}
+		}
+		double bytecodeTime = elapsedMicroseconds(start) * 1000 / (20 * vmRows.size());
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			for (const CompiledExpression::VariableArray& row : vmRows)
+			{
+				checksum += registerProgram.evaluate(row);
+			}
+		}
+		double registerTime = elapsedMicroseconds(start) * 1000 / (20 * vmRows.size());
+
+		cout << infixExpr << " (" << compiled.getBytecode().size() << " tokens, "
+			<< registerProgram.getInstructions().size() << " instructions)" << endl;
+		cout << "  bytecode: " << bytecodeTime << "  register VM: " << registerTime
+			<< "  speedup: " << bytecodeTime / registerTime << "x" << endl;
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// The same expressions over columnar rows: native code versus the register VM
+	cout << "=== JIT versus register VM on columns (ns/row) ===" << endl;
+	std::vector<std::vector<std::int32_t>> variableColumns(CompiledExpression::VARIABLE_CAPACITY, std::vector<std::int32_t>(vmRows.size()));
+	for (size_t row = 0; row < vmRows.size(); ++row)
+	{
+		for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+		{
+			variableColumns[variable][row] = vmRows[row][variable];
+		}
+	}
+	const std::int32_t* columnPointers[CompiledExpression::VARIABLE_CAPACITY];
+	for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+	{
+		columnPointers[variable] = variableColumns[variable].data();
+	}
+	std::vector<double> columnResults(vmRows.size());
+	for (const std::string& infixExpr : typicalExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+		RegisterProgram registerProgram(compiled);
+		JitProgram jitProgram(compiled);
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			for (size_t row = 0; row < vmRows.size(); ++row)
+			{
+				columnResults[row] = registerProgram.evaluate(vmRows[row]);
+			}
+			checksum += columnResults[0];
+		}
+		double registerTime = elapsedMicroseconds(start) * 1000 / (20 * vmRows.size());
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			jitProgram.evaluateColumns(columnPointers, columnResults.data(), vmRows.size());
+			checksum += columnResults[0];
+		}
+		double jitTime = elapsedMicroseconds(start) * 1000 / (20 * vmRows.size());
+
+		cout << infixExpr << (jitProgram.isNative() ? " (native)" : " (interpreted)") << endl;
+		cout << "  register VM: " << registerTime << "  JIT: " << jitTime << "  speedup: " << registerTime / jitTime << "x" << endl;
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// One very long sum: the serial left fold versus blocked pairwise reduction on one and several threads
+	cout << "=== Long associative chain (us/evaluation) ===" << endl;
+	const std::string chainTerms[][2] = { { "+b", "+c" }, { "+a/b", "+c*d" } };
+	for (const auto& termPair : chainTerms)
+	{
+		std::string longChain = "a";
+		for (int i = 1; i < 200000; ++i)
+		{
+			longChain += termPair[i % 2];
+		}
+		evaluator.convertInfixToPostfix(longChain);
+		CompiledExpression chainExpression = evaluator.compilePostfixExpression();
+		CompiledExpression::VariableArray chainValues = { 1, 3, 2, 7, 5, 6 };
+		ChainProgram sequentialProgram(chainExpression);
+		ChainProgram pairwiseProgram(chainExpression, ChainProgram::ReductionOrder::Pairwise);
+		std::vector<double> nodeValues;
+
+		RegisterProgram registerProgram(chainExpression);
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			checksum += registerProgram.evaluate(chainValues);
+		}
+		double registerTime = elapsedMicroseconds(start) / 20;
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			checksum += sequentialProgram.evaluate(chainValues, nodeValues);
+		}
+		double sequentialTime = elapsedMicroseconds(start) / 20;
+
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			checksum += pairwiseProgram.evaluate(chainValues, nodeValues);
+		}
+		double pairwiseTime = elapsedMicroseconds(start) / 20;
+
+		pairwiseProgram.setThreadCount(0);
+		start = chrono::steady_clock::now();
+		for (int repetition = 0; repetition < 20; ++repetition)
+		{
+			checksum += pairwiseProgram.evaluate(chainValues, nodeValues);
+		}
+		double threadedTime = elapsedMicroseconds(start) / 20;
+
+		cout << "a" << termPair[1] << termPair[0] << "... (200000 terms)" << endl;
+		cout << "  register VM: " << registerTime << "  sequential chain: " << sequentialTime
+			<< "  pairwise: " << pairwiseTime << "  pairwise threaded: " << threadedTime << endl;
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// Hundreds of formulas on a single row: one register program per formula versus lanes across formulas
+	cout << "=== Many formulas on one row (us/row) ===" << endl;
+	const std::string laneShapes[] = { "x+x*x", "(x+x)*(x-x)", "x*x-x/x", "x+x+x+x", "(x-x)*x+x*x" };
+	std::vector<RegisterProgram> registerPrograms;
+	MultiExpressionEvaluator multiEvaluator;
+	std::mt19937 shapeGenerator(7);
+	for (int i = 0; i < 500; ++i)
+	{
+		std::string formula = laneShapes[i % 5];
+		for (char& currentChar : formula)
+		{
+			if (currentChar == 'x')
+			{
+				currentChar = static_cast<char>('a' + shapeGenerator() % 6);
+			}
+		}
+		evaluator.convertInfixToPostfix(formula);
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+		registerPrograms.emplace_back(compiled);
+		multiEvaluator.addFormula(compiled.getPostfixExpression());
+	}
+
+	std::vector<CompiledExpression::VariableArray> singleRows = generateRows(1000);
+	start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : singleRows)
+	{
+		for (const RegisterProgram& program : registerPrograms)
+		{
+			checksum += program.evaluate(row);
+		}
+	}
+	double perFormulaTime = elapsedMicroseconds(start) / singleRows.size();
+
+	std::vector<FormulaResult> laneResults;
+	start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : singleRows)
+	{
+		multiEvaluator.evaluate(row, laneResults);
+		checksum += laneResults[0].value;
+	}
+	double laneTime = elapsedMicroseconds(start) / singleRows.size();
+
+	cout << registerPrograms.size() << " formulas in " << multiEvaluator.getGroupCount() << " groups" << endl;
+	cout << "  register VM per formula: " << perFormulaTime << endl;
+	cout << "  lanes across formulas:   " << laneTime << endl;
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// One shared program, one context per thread, from one thread up to every hardware thread
+	cout << "=== Shared program scaling (million evaluations/s) ===" << endl;
+	evaluator.convertInfixToPostfix("(a+b)*(c-d)+e*f-a/b");
+	const CompiledExpression sharedProgram = evaluator.compilePostfixExpression();
+	unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<CompiledExpression::VariableArray> scalingRows = generateRows(10000);
+	std::vector<unsigned int> threadCounts;
+	for (unsigned int threadCount = 1; threadCount < maxThreads; threadCount *= 2)
+	{
+		threadCounts.push_back(threadCount);
+	}
+	threadCounts.push_back(maxThreads);
+	for (unsigned int threadCount : threadCounts)
+	{
+		std::vector<double> threadChecksums(threadCount);
+		std::vector<std::thread> threads;
+		start = chrono::steady_clock::now();
+		for (unsigned int i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&, i]
+				{
+					EvaluationContext context;
+					double threadChecksum = 0;
+					for (int repetition = 0; repetition < 50; ++repetition)
+					{
+						for (const CompiledExpression::VariableArray& row : scalingRows)
+						{
+							context.setVariableValues(row);
+							threadChecksum += context.evaluate(sharedProgram);
+						}
+					}
+					threadChecksums[i] = threadChecksum;
+				});
+		}
+		for (std::thread& worker : threads)
+		{
+			worker.join();
+		}
+		double elapsed = elapsedMicroseconds(start);
+		for (double threadChecksum : threadChecksums)
+		{
+			checksum += threadChecksum;
+		}
+		cout << threadCount << " threads: " << (50.0 * scalingRows.size() * threadCount) / elapsed << endl;
+	}
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// Rows drawn from a small pool repeat often, as in the production input
+	cout << "=== Memoized evaluation (ns/row) ===" << endl;
+	evaluator.convertInfixToPostfix(generateExpression(64));
+	const CompiledExpression memoProgram = evaluator.compilePostfixExpression();
+	std::vector<CompiledExpression::VariableArray> rowPool = generateRows(500);
+	std::vector<CompiledExpression::VariableArray> repeatedRows(200000);
+	std::mt19937 rowPicker(11);
+	for (CompiledExpression::VariableArray& row : repeatedRows)
+	{
+		row = rowPool[rowPicker() % rowPool.size()];
+	}
+
+	EvaluationContext plainContext;
+	start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : repeatedRows)
+	{
+		plainContext.setVariableValues(row);
+		checksum += plainContext.evaluate(memoProgram);
+	}
+	double plainTime = elapsedMicroseconds(start) * 1000 / repeatedRows.size();
+
+	ResultMemo memo(1024);
+	size_t memoId = memo.addExpression(memoProgram);
+	start = chrono::steady_clock::now();
+	for (const CompiledExpression::VariableArray& row : repeatedRows)
+	{
+		checksum += memo.evaluate(memoId, row);
+	}
+	double memoTime = elapsedMicroseconds(start) * 1000 / repeatedRows.size();
+
+	cout << memoProgram.getBytecode().size() << " tokens, " << rowPool.size() << " distinct rows" << endl;
+	cout << "  plain: " << plainTime << "  memoized: " << memoTime
+		<< "  hit rate: " << memo.getHitRate() << endl;
+	cout << "Checksum: " << checksum << endl << endl;
+
+	// A formula catalog converted one call at a time versus in bulk
+	cout << "=== Catalog conversion (ms for 200000 formulas) ===" << endl;
+	std::vector<std::string> catalog;
+	catalog.reserve(200000);
+	for (int i = 0; i < 200000; ++i)
+	{
+		catalog.push_back(generateExpression(4 + i % 28));
+	}
+
+	size_t serialLength = 0;
+	start = chrono::steady_clock::now();
+	for (const std::string& formula : catalog)
+	{
+		evaluator.convertInfixToPostfix(formula);
+		serialLength += evaluator.getPostfixExpression().size();
+	}
+	double serialTime = elapsedMicroseconds(start) / 1000;
+
+	BulkConverter bulkConverter;
+	start = chrono::steady_clock::now();
+	bulkConverter.convert(catalog);
+	double bulkTime = elapsedMicroseconds(start) / 1000;
+
+	cout << "  one at a time: " << serialTime << "  bulk (" << std::max(1u, std::thread::hardware_concurrency())
+		<< " threads): " << bulkTime << endl;
+	cout << "  packed bytes: " << bulkConverter.getPostfixBuffer().size() << " (serial " << serialLength << "), failures: "
+		<< bulkConverter.getFailures().size() << endl << endl;
+
+	// Exporting one million results: iostreams one double at a time versus to_chars into large buffers
+	cout << "=== Result export (ms for 1000000 results) ===" << endl;
+	std::vector<double> exportResults(1000000);
+	std::mt19937 exportGenerator(11);
+	std::uniform_real_distribution<double> exportDistribution(-1e6, 1e6);
+	for (double& result : exportResults)
+	{
+		result = exportDistribution(exportGenerator);
+	}
+
+	start = chrono::steady_clock::now();
+	{
+		std::ofstream streamFile("benchmarkResults.csv");
+		streamFile.precision(17);
+		for (double result : exportResults)
+		{
+			streamFile << result << '\n';
+		}
+	}
+	double streamTime = elapsedMicroseconds(start) / 1000;
+
+	start = chrono::steady_clock::now();
+	{
+		ResultWriter csvWriter("benchmarkResults.csv");
+		csvWriter.writeCsv(exportResults.data(), exportResults.size());
+	}
+	double csvTime = elapsedMicroseconds(start) / 1000;
+
+	start = chrono::steady_clock::now();
+	{
+		ResultWriter binaryWriter("benchmarkResults.bin");
+		binaryWriter.writeBinaryColumn(exportResults.data(), exportResults.size());
+	}
+	double binaryTime = elapsedMicroseconds(start) / 1000;
+	std::remove("benchmarkResults.csv");
+	std::remove("benchmarkResults.bin");
+
+	cout << "  ofstream: " << streamTime << "  ResultWriter CSV: " << csvTime << "  binary: " << binaryTime << endl << endl;
+
+	// Loading and evaluating one million rows: parsing text versus mapping int32 columns
+	cout << "=== Variable input (ms for 1000000 rows) ===" << endl;
+	{
+		std::vector<CompiledExpression::VariableArray> inputRows = generateRows(1000000);
+		{
+			std::ofstream textFile("benchmarkRows.txt");
+			for (const CompiledExpression::VariableArray& row : inputRows)
+			{
+				textFile << row[0] << ' ' << row[1] << ' ' << row[2] << ' ' << row[3] << ' ' << row[4] << ' ' << row[5] << '\n';
+			}
+		}
+		ColumnarVariablesWriter columnWriter(ColumnarVariables::ColumnType::Int32);
+		columnWriter.readTextFile("benchmarkRows.txt");
+		columnWriter.writeToFile("benchmarkRows.pfxc");
+
+		evaluator.convertInfixToPostfix("(a+b)*(c-d)+e*f-a/b");
+		CompiledExpression inputProgram = evaluator.compilePostfixExpression();
+		RegisterProgram inputRegisterProgram(inputProgram);
+		JitProgram inputJitProgram(inputProgram);
+		std::vector<double> inputResults(inputRows.size());
+
+		start = chrono::steady_clock::now();
+		{
+			std::ifstream textFile("benchmarkRows.txt");
+			CompiledExpression::VariableArray row;
+			size_t rowIndex = 0;
+			while (textFile >> row[0] >> row[1] >> row[2] >> row[3] >> row[4] >> row[5])
+			{
+				inputResults[rowIndex++] = inputRegisterProgram.evaluate(row);
+			}
+		}
+		double textTime = elapsedMicroseconds(start) / 1000;
+		checksum += inputResults.back();
+
+		start = chrono::steady_clock::now();
+		{
+			MappedFile mappedRows("benchmarkRows.pfxc");
+			ColumnarVariables columns(mappedRows.data(), mappedRows.size());
+			columns.evaluate(inputJitProgram, inputResults.data());
+		}
+		double columnarTime = elapsedMicroseconds(start) / 1000;
+		checksum += inputResults.back();
+		std::remove("benchmarkRows.txt");
+		std::remove("benchmarkRows.pfxc");
+
+		cout << "  text parse + register VM: " << textTime << "  mapped columns + JIT: " << columnarTime << endl << endl;
+
+		// Aggregates over the same rows: materialize every result and fold it afterwards, versus folding inside the evaluation loop
+		cout << "=== Aggregation over 1000000 rows (ms) ===" << endl;
+		const std::int32_t* inputColumns[CompiledExpression::VARIABLE_CAPACITY];
+		std::vector<std::vector<std::int32_t>> inputColumnData(CompiledExpression::VARIABLE_CAPACITY, std::vector<std::int32_t>(inputRows.size()));
+		for (size_t row = 0; row < inputRows.size(); ++row)
+		{
+			for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+			{
+				inputColumnData[variable][row] = inputRows[row][variable];
+			}
+		}
+		for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+		{
+			inputColumns[variable] = inputColumnData[variable].data();
+		}
+		const std::vector<double> bucketBounds = { -1000, -100, 0, 100, 1000 };
+
+		start = chrono::steady_clock::now();
+		std::vector<double> materialized(inputRows.size());
+		inputJitProgram.evaluateColumns(inputColumns, materialized.data(), materialized.size());
+		ResultAggregate separate(bucketBounds);
+		separate.record(materialized.data(), materialized.size());
+		double separateTime = elapsedMicroseconds(start) / 1000;
+
+		BatchAggregator batchAggregator;
+		start = chrono::steady_clock::now();
+		ResultAggregate fused = batchAggregator.aggregate(inputJitProgram, inputColumns, inputRows.size(), bucketBounds);
+		double fusedTime = elapsedMicroseconds(start) / 1000;
+
+		batchAggregator.setThreadCount(0);
+		start = chrono::steady_clock::now();
+		ResultAggregate threaded = batchAggregator.aggregate(inputJitProgram, inputColumns, inputRows.size(), bucketBounds);
+		double threadedTime = elapsedMicroseconds(start) / 1000;
+		checksum += separate.getMean() + fused.getMean() + threaded.getMean();
+
+		cout << "  materialize then aggregate: " << separateTime << "  fused: " << fusedTime
+			<< "  fused on " << std::max(1u, std::thread::hardware_concurrency()) << " threads: " << threadedTime << endl;
+	}
+	cout << "Checksum: " << checksum << endl;
+	return 0;
+}
@@ -0,0 +1,204 @@
+/** @file BulkConverter.cpp
+ * BulkConverter converts ranges of a formula catalog in parallel into one packed postfix buffer.
+ * @class BulkConverter
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "BulkConverter.h"
+#include "CompiledExpression.h"
+#include "StreamingConverter.h"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+BulkConverter::BulkConverter(size_t threads) : offsets(1, 0), threadCount(threads)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+} // end constructor
+
+const char* BulkConverter::validatePostfix(std::string_view postfixExpression) noexcept
+{
+    // Operand counting in the order CompiledExpression reports errors
+    size_t depth = 0;
+    for (char currentChar : postfixExpression)
+    {
+        if (currentChar >= 'a' && currentChar < 'a' + static_cast<int>(CompiledExpression::VARIABLE_CAPACITY))
+        {
+            ++depth;
+            continue;
+        }
+        if (depth < 2)
+        {
+            return "Invalid postfix expression";
+        }
+        if (currentChar != '+' && currentChar != '-' && currentChar != '*' && currentChar != '/')
+        {
+            return "Unknown operator encountered";
+        }
+        --depth;
+    }
+    return depth == 1 ? nullptr : "Invalid postfix expression";
+} // end validatePostfix
+
+void BulkConverter::convert(std::span<const std::string> infixExpressions)
+{
+    size_t expressionCount = infixExpressions.size();
+    size_t workerCount = std::max<size_t>(1, std::min(threadCount, expressionCount));
+    size_t rangeSize = (expressionCount + workerCount - 1) / workerCount;
+
+    // Output of one worker: a packed buffer and the end offset of each expression in its range
+    struct RangeOutput
+    {
+        std::string buffer;
+        std::vector<size_t> ends;
+        std::vector<ConversionFailure> failures;
+        std::exception_ptr error;  // Anything other than a conversion error, rethrown after every worker joins
+    };
+    std::vector<RangeOutput> rangeOutputs(workerCount);
+
+    auto convertRange = [&](size_t worker)
+        {
+            size_t first = std::min(expressionCount, worker * rangeSize);
+            size_t last = std::min(expressionCount, first + rangeSize);
+            RangeOutput& output = rangeOutputs[worker];
+            try
+            {
+                output.ends.reserve(last - first);
+
+                // Postfix is never longer than its infix, so one reservation covers the range
+                size_t infixBytes = 0;
+                for (size_t i = first; i < last; ++i)
+                {
+                    infixBytes += infixExpressions[i].size();
+                }
+                output.buffer.reserve(infixBytes);
+
+                StreamingConverter converter([&output](const char* data, size_t length) { output.buffer.append(data, length); });
+                for (size_t i = first; i < last; ++i)
+                {
+                    size_t start = output.buffer.size();
+                    const char* error = nullptr;
+                    try
+                    {
+                        converter.feed(infixExpressions[i].data(), infixExpressions[i].size());
+                        converter.finish();
+                        error = validatePostfix(std::string_view(output.buffer).substr(start));
+                    }
+                    catch (const std::runtime_error& e)
+                    {
+                        output.buffer.resize(start);
+                        output.failures.push_back(ConversionFailure{ i, e.what() });
+                    }
+                    if (error != nullptr)
+                    {
+                        output.buffer.resize(start);
+                        output.failures.push_back(ConversionFailure{ i, error });
+                    }
+                    output.ends.push_back(output.buffer.size());
+                }
+            }
+            catch (...)
+            {
+                output.error = std::current_exception();
+            }
+        };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t worker = 1; worker < workerCount; ++worker)
+    {
+        try
+        {
+            workers.emplace_back(convertRange, worker);
+        }
+        catch (const std::system_error&)
+        {
+            convertRange(worker);  // No thread could be started, so convert the range here
+        }
+    }
+    convertRange(0);  // The calling thread takes the first range
+    for (std::thread& workerThread : workers)
+    {
+        workerThread.join();
+    }
+    for (const RangeOutput& output : rangeOutputs)
+    {
+        if (output.error)
+        {
+            std::rethrow_exception(output.error);
+        }
+    }
+
+    // Stitch the ranges together in order
+    size_t totalBytes = 0;
+    for (const RangeOutput& output : rangeOutputs)
+    {
+        totalBytes += output.buffer.size();
+    }
+    postfixBuffer.clear();
+    postfixBuffer.reserve(totalBytes);
+    offsets.assign(1, 0);
+    offsets.reserve(expressionCount + 1);
+    converted.assign(expressionCount, 1);
+    failures.clear();
+
+    for (RangeOutput& output : rangeOutputs)
+    {
+        size_t base = postfixBuffer.size();
+        postfixBuffer += output.buffer;
+        for (size_t end : output.ends)
+        {
+            offsets.push_back(base + end);
+        }
+        for (ConversionFailure& failure : output.failures)
+        {
+            converted[failure.index] = 0;
+            failures.push_back(std::move(failure));
+        }
+    }
+} // end convert
+
+size_t BulkConverter::getExpressionCount() const noexcept
+{
+    return offsets.size() - 1;
+} // end getExpressionCount
+
+std::string_view BulkConverter::getPostfixExpression(size_t index) const
+{
+    if (index >= getExpressionCount())
+    {
+        throw std::out_of_range("Expression index out of range");
+    }
+    return std::string_view(postfixBuffer).substr(offsets[index], offsets[index + 1] - offsets[index]);
+} // end getPostfixExpression
+
+bool BulkConverter::isConverted(size_t index) const
+{
+    if (index >= getExpressionCount())
+    {
+        throw std::out_of_range("Expression index out of range");
+    }
+    return converted[index] != 0;
+} // end isConverted
+
+const std::string& BulkConverter::getPostfixBuffer() const noexcept
+{
+    return postfixBuffer;
+} // end getPostfixBuffer
+
+const std::vector<size_t>& BulkConverter::getOffsets() const noexcept
+{
+    return offsets;
+} // end getOffsets
+
+const std::vector<BulkConverter::ConversionFailure>& BulkConverter::getFailures() const noexcept
+{
+    return failures;
+} // end getFailures
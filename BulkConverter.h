@@ -0,0 +1,95 @@
+/** @file BulkConverter.h
+ * @class BulkConverter
+ * Converts a whole catalog of infix expressions at once. The catalog is split into contiguous ranges converted in parallel, and every postfix expression is packed into one contiguous character buffer indexed by an offsets array, instead of one LinkedDeque per expression. Expressions that fail to convert or validate are reported by index and leave an empty entry, without stopping the rest of the batch.
+ */
+
+#ifndef BULK_CONVERTER_
+#define BULK_CONVERTER_
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class BulkConverter
+{
+public:
+    /** An expression that could not be converted. */
+    struct ConversionFailure
+    {
+        /** Position of the expression in the converted span. */
+        size_t index;
+
+        /** The error message conversion or validation would have thrown. */
+        std::string message;
+    };
+
+private:
+    /** Every converted postfix expression, back to back. */
+    std::string postfixBuffer;
+
+    /** Expression i occupies postfixBuffer[offsets[i], offsets[i + 1]). Holds one more entry than there are expressions. */
+    std::vector<size_t> offsets;
+
+    /** Nonzero for each expression that converted successfully. */
+    std::vector<std::uint8_t> converted;
+
+    /** Every failed expression, in index order. */
+    std::vector<ConversionFailure> failures;
+
+    /** Number of threads used to convert. */
+    size_t threadCount;
+
+    /** Helper function to check a postfix expression the same way CompiledExpression does, without building it.
+     * @pre None
+     * @post None
+     * @param postfixExpression The postfix tokens to check.
+     * @return nullptr if the expression is valid, otherwise the error message CompiledExpression would throw. */
+    static const char* validatePostfix(std::string_view postfixExpression) noexcept;
+
+public:
+    /** Creates a converter with no results.
+     * @pre None
+     * @post No expressions are held.
+     * @param threads Number of conversion threads. Zero uses the number of hardware threads. */
+    explicit BulkConverter(size_t threads = 0);
+
+    /** Converts a catalog of infix expressions, replacing any previous results.
+     * @pre None
+     * @post Every expression is converted or listed in getFailures. The input is unchanged.
+     * @param infixExpressions The expressions to convert.
+     * @throws std::bad_alloc If a worker runs out of memory. Any other exception a worker throws is passed on the same way, on the calling thread after every worker has finished. The previous results are kept. */
+    void convert(std::span<const std::string> infixExpressions);
+
+    /** Retrieves the number of expressions of the last conversion.
+     * @return The expression count. */
+    size_t getExpressionCount() const noexcept;
+
+    /** Retrieves one postfix expression.
+     * @pre index is less than getExpressionCount().
+     * @post None
+     * @param index Position of the expression in the converted span.
+     * @return A view into the packed buffer, empty if the expression failed. */
+    std::string_view getPostfixExpression(size_t index) const;
+
+    /** Sees whether an expression converted successfully.
+     * @pre index is less than getExpressionCount().
+     * @return True if the expression converted and validated. */
+    bool isConverted(size_t index) const;
+
+    /** Retrieves the packed buffer of every postfix expression.
+     * @return The buffer described by getOffsets. */
+    const std::string& getPostfixBuffer() const noexcept;
+
+    /** Retrieves the start of every expression in the packed buffer.
+     * @return getExpressionCount() + 1 offsets, the last being the buffer size. */
+    const std::vector<size_t>& getOffsets() const noexcept;
+
+    /** Retrieves every expression that failed.
+     * @return The failures, in index order. */
+    const std::vector<ConversionFailure>& getFailures() const noexcept;
+};
+
+#include "BulkConverter.cpp"
+#endif
@@ -0,0 +1,67 @@
+/** @file BytecodeBackend.cpp
+ * BytecodeBackend interprets compact bytecode with a flat operand array.
+ * @class BytecodeBackend
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "BytecodeBackend.h"
+
+double BytecodeBackend::run(const std::uint8_t* code, size_t codeLength, size_t maxStackDepth,
+    const CompiledExpression::VariableArray& variableValues)
+{
+    if (maxStackDepth <= INLINE_STACK_CAPACITY)
+    {
+        double stack[INLINE_STACK_CAPACITY];
+        return run(code, codeLength, stack, variableValues);
+    }
+
+    std::vector<double> stack(maxStackDepth);
+    return run(code, codeLength, stack.data(), variableValues);
+} // end run
+
+double BytecodeBackend::run(const std::uint8_t* code, size_t codeLength, double* stack,
+    const CompiledExpression::VariableArray& variableValues)
+{
+    using Opcode = CompiledExpression::Opcode;
+    double* top = stack;  // One past the topmost operand
+
+    for (size_t i = 0; i < codeLength; ++i)
+    {
+        switch (static_cast<Opcode>(code[i]))
+        {
+        case Opcode::Add: top[-2] = top[-2] + top[-1]; --top; break;
+        case Opcode::Subtract: top[-2] = top[-2] - top[-1]; --top; break;
+        case Opcode::Multiply: top[-2] = top[-2] * top[-1]; --top; break;
+        case Opcode::Divide:
+            if (top[-1] == 0) throw std::runtime_error("Division by zero");
+            top[-2] = top[-2] / top[-1];
+            --top;
+            break;
+        default:  // LoadA through LoadF
+            *top++ = variableValues[code[i]];
+            break;
+        }
+    }
+
+    return top[-1];
+} // end run
+
+double BytecodeBackend::execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+    std::pmr::memory_resource* resource) const
+{
+    const std::vector<std::uint8_t>& bytecode = expression.getBytecode();
+    if (expression.getMaxStackDepth() <= INLINE_STACK_CAPACITY)
+    {
+        return run(bytecode.data(), bytecode.size(), expression.getMaxStackDepth(), variableValues);
+    }
+
+    std::pmr::vector<double> stack(expression.getMaxStackDepth(), resource);
+    return run(bytecode.data(), bytecode.size(), stack.data(), variableValues);
+} // end execute
+
+std::string BytecodeBackend::getName() const
+{
+    return "bytecode";
+} // end getName
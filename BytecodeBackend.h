@@ -0,0 +1,59 @@
+/** @file BytecodeBackend.h
+ * @class BytecodeBackend
+ * Execution backend that interprets the one-byte-per-instruction bytecode of a compiled expression on a flat operand array.
+ */
+
+#ifndef BYTECODE_BACKEND_
+#define BYTECODE_BACKEND_
+
+#include "ExecutionBackendInterface.h"
+
+class BytecodeBackend : public ExecutionBackendInterface
+{
+private:
+    /** Operand stack size that is kept on the call stack. Deeper expressions use a heap buffer. */
+    static constexpr size_t INLINE_STACK_CAPACITY = 64;
+
+public:
+    /** Interprets a bytecode stream.
+     * @pre code holds codeLength valid instructions that need at most maxStackDepth operands.
+     * @post None
+     * @param code Pointer to the first instruction.
+     * @param codeLength The number of instructions.
+     * @param maxStackDepth The maximum number of operands on the stack at once.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    static double run(const std::uint8_t* code, size_t codeLength, size_t maxStackDepth,
+        const CompiledExpression::VariableArray& variableValues);
+
+    /** Interprets a bytecode stream using a caller-provided operand array.
+     * @pre code holds codeLength valid instructions and stack has room for all of their operands.
+     * @post The contents of stack are overwritten.
+     * @param code Pointer to the first instruction.
+     * @param codeLength The number of instructions.
+     * @param stack Scratch space for the operand stack.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    static double run(const std::uint8_t* code, size_t codeLength, double* stack,
+        const CompiledExpression::VariableArray& variableValues);
+
+    /** Evaluates a compiled expression by interpreting its bytecode.
+     * @pre None
+     * @post The expression and variable values are unchanged.
+     * @param expression The compiled expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @param resource Memory resource for an operand stack too deep for the inline buffer.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+        std::pmr::memory_resource* resource) const override;
+
+    /** Retrieves the name of this backend.
+     * @return "bytecode" */
+    std::string getName() const override;
+};
+
+#include "BytecodeBackend.cpp"
+#endif
@@ -0,0 +1,284 @@
+/** @file ChainProgram.cpp
+ * ChainProgram collapses runs of one associative operator and reduces them sequentially or in a blocked pairwise order.
+ * @class ChainProgram
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ChainProgram.h"
+#include <algorithm>
+#include <thread>
+
+ChainProgram::ChainProgram(const CompiledExpression& expression, ReductionOrder order, size_t minChainLength)
+    : rootIndex(-1), reductionOrder(order), threadCount(1), chainCount(0), longestChain(0)
+{
+    const std::vector<CompiledExpression::AstNode>& arena = expression.getAstArena();
+    size_t nodeCount = arena.size();
+
+    // Pass 1, parents before children: join each + or * node to its parent's chain where the order allows.
+    // Sequential order only follows left operands, which is exactly the left fold the postfix expression encodes.
+    std::vector<int> parent(nodeCount, -1);
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        if (arena[i].left >= 0)
+        {
+            parent[arena[i].left] = static_cast<int>(i);
+            parent[arena[i].right] = static_cast<int>(i);
+        }
+    }
+
+    std::vector<int> chainRoot(nodeCount, -1);
+    std::vector<size_t> memberCount(nodeCount, 0);
+    for (size_t i = nodeCount; i-- > 0;)
+    {
+        char token = arena[i].token;
+        if (token != '+' && token != '*')
+        {
+            continue;
+        }
+        int up = parent[i];
+        bool joinsParent = up >= 0 && arena[up].token == token &&
+            (order == ReductionOrder::Pairwise || arena[up].left == static_cast<int>(i));
+        chainRoot[i] = joinsParent ? chainRoot[up] : static_cast<int>(i);
+        ++memberCount[chainRoot[i]];
+    }
+
+    // Pass 2, children before parents: emit nodes, replacing each long enough chain by one chain node
+    std::vector<int> newIndex(nodeCount, -1);
+    std::vector<int> pending;
+    nodes.reserve(nodeCount);
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        const CompiledExpression::AstNode& astNode = arena[i];
+        int root = chainRoot[i];
+        bool collapsed = root >= 0 && memberCount[root] + 1 >= minChainLength && memberCount[root] > 1;
+
+        if (astNode.left < 0)
+        {
+            newIndex[i] = astNode.token - 'a';
+            continue;
+        }
+        else if (!collapsed)
+        {
+            NodeKind kind = NodeKind::Divide;  // The compiled expression only holds + - * /
+            switch (astNode.token)
+            {
+            case '+': kind = NodeKind::Add; break;
+            case '-': kind = NodeKind::Subtract; break;
+            case '*': kind = NodeKind::Multiply; break;
+            }
+            nodes.push_back(ChainNode{ kind, astNode.token, newIndex[astNode.left], newIndex[astNode.right] });
+        }
+        else if (root != static_cast<int>(i))
+        {
+            continue;  // Inner member, emitted as part of its chain root
+        }
+        else
+        {
+            // Collect the terms left to right: descend through members, stop at anything else
+            int firstTerm = static_cast<int>(chainTerms.size());
+            pending.assign(1, static_cast<int>(i));
+            while (!pending.empty())
+            {
+                int current = pending.back();
+                pending.pop_back();
+                if (chainRoot[current] == root)
+                {
+                    pending.push_back(arena[current].right);
+                    pending.push_back(arena[current].left);
+                }
+                else
+                {
+                    chainTerms.push_back(newIndex[current]);
+                }
+            }
+
+            int termCount = static_cast<int>(chainTerms.size()) - firstTerm;
+            nodes.push_back(ChainNode{ NodeKind::Chain, astNode.token, firstTerm, termCount });
+            ++chainCount;
+            longestChain = std::max(longestChain, static_cast<size_t>(termCount));
+        }
+        newIndex[i] = static_cast<int>(CompiledExpression::VARIABLE_CAPACITY + nodes.size()) - 1;
+    }
+    rootIndex = newIndex[expression.getAstRoot()];
+} // end constructor
+
+void ChainProgram::setThreadCount(size_t threads) noexcept
+{
+    threadCount = threads == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : threads;
+} // end setThreadCount
+
+double ChainProgram::reduceBlock(char operatorChar, const double* nodeValues, const int* terms, size_t count) noexcept
+{
+    bool add = operatorChar == '+';
+    if (count < 8)
+    {
+        double result = nodeValues[terms[0]];
+        for (size_t i = 1; i < count; ++i)
+        {
+            result = add ? result + nodeValues[terms[i]] : result * nodeValues[terms[i]];
+        }
+        return result;
+    }
+
+    // Four interleaved accumulators break the serial dependency; term i always goes to lane i % 4
+    double lanes[4] = { nodeValues[terms[0]], nodeValues[terms[1]], nodeValues[terms[2]], nodeValues[terms[3]] };
+    size_t i = 4;
+    if (add)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            lanes[0] += nodeValues[terms[i]];
+            lanes[1] += nodeValues[terms[i + 1]];
+            lanes[2] += nodeValues[terms[i + 2]];
+            lanes[3] += nodeValues[terms[i + 3]];
+        }
+        for (; i < count; ++i)
+        {
+            lanes[i % 4] += nodeValues[terms[i]];
+        }
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        lanes[0] *= nodeValues[terms[i]];
+        lanes[1] *= nodeValues[terms[i + 1]];
+        lanes[2] *= nodeValues[terms[i + 2]];
+        lanes[3] *= nodeValues[terms[i + 3]];
+    }
+    for (; i < count; ++i)
+    {
+        lanes[i % 4] *= nodeValues[terms[i]];
+    }
+    return (lanes[0] * lanes[1]) * (lanes[2] * lanes[3]);
+} // end reduceBlock
+
+double ChainProgram::reduceChain(const ChainNode& chain, const double* nodeValues) const
+{
+    const int* terms = chainTerms.data() + chain.left;
+    size_t termCount = static_cast<size_t>(chain.right);
+
+    if (reductionOrder == ReductionOrder::Sequential)
+    {
+        double result = nodeValues[terms[0]];
+        if (chain.token == '+')
+        {
+            for (size_t i = 1; i < termCount; ++i)
+            {
+                result += nodeValues[terms[i]];
+            }
+        }
+        else
+        {
+            for (size_t i = 1; i < termCount; ++i)
+            {
+                result *= nodeValues[terms[i]];
+            }
+        }
+        return result;
+    }
+
+    // Fixed blocks, so the rounding never depends on how many threads share them
+    size_t blockCount = (termCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    std::vector<double> blockResults(blockCount);
+    auto reduceBlocks = [&](size_t firstBlock, size_t step)
+        {
+            for (size_t block = firstBlock; block < blockCount; block += step)
+            {
+                size_t start = block * BLOCK_SIZE;
+                blockResults[block] = reduceBlock(chain.token, nodeValues, terms + start, std::min(BLOCK_SIZE, termCount - start));
+            }
+        };
+
+    size_t workers = std::min(threadCount, blockCount / 2);
+    if (workers > 1)
+    {
+        std::vector<std::thread> threads;
+        for (size_t worker = 1; worker < workers; ++worker)
+        {
+            threads.emplace_back(reduceBlocks, worker, workers);
+        }
+        reduceBlocks(0, workers);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        reduceBlocks(0, 1);
+    }
+
+    // Combine neighbouring block results level by level
+    while (blockResults.size() > 1)
+    {
+        size_t half = blockResults.size() / 2;
+        for (size_t i = 0; i < half; ++i)
+        {
+            double leftValue = blockResults[2 * i];
+            double rightValue = blockResults[2 * i + 1];
+            blockResults[i] = chain.token == '+' ? leftValue + rightValue : leftValue * rightValue;
+        }
+        if (blockResults.size() % 2 != 0)
+        {
+            blockResults[half] = blockResults.back();
+            ++half;
+        }
+        blockResults.resize(half);
+    }
+    return blockResults[0];
+} // end reduceChain
+
+double ChainProgram::evaluate(const CompiledExpression::VariableArray& variableValues) const
+{
+    std::vector<double> nodeValues;
+    return evaluate(variableValues, nodeValues);
+} // end evaluate
+
+double ChainProgram::evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<double>& nodeValues) const
+{
+    nodeValues.resize(CompiledExpression::VARIABLE_CAPACITY + nodes.size());
+    double* values = nodeValues.data();
+    for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+    {
+        values[variable] = variableValues[variable];
+    }
+
+    double* result = values + CompiledExpression::VARIABLE_CAPACITY;
+    for (const ChainNode& node : nodes)
+    {
+        switch (node.kind)
+        {
+        case NodeKind::Add:
+            *result = values[node.left] + values[node.right];
+            break;
+        case NodeKind::Subtract:
+            *result = values[node.left] - values[node.right];
+            break;
+        case NodeKind::Multiply:
+            *result = values[node.left] * values[node.right];
+            break;
+        case NodeKind::Divide:
+            if (values[node.right] == 0) throw std::runtime_error("Division by zero");
+            *result = values[node.left] / values[node.right];
+            break;
+        case NodeKind::Chain:
+            *result = reduceChain(node, values);
+            break;
+        }
+        ++result;
+    }
+    return nodeValues[rootIndex];
+} // end evaluate
+
+size_t ChainProgram::getChainCount() const noexcept
+{
+    return chainCount;
+} // end getChainCount
+
+size_t ChainProgram::getLongestChain() const noexcept
+{
+    return longestChain;
+} // end getLongestChain
@@ -0,0 +1,122 @@
+/** @file ChainProgram.h
+ * @class ChainProgram
+ * Evaluates expressions containing long runs of one associative operator, such as a+b+c+...+f with thousands of terms, which conversion turns into a strictly left-deep, serial chain. Runs of + or * are collapsed into chain nodes holding their terms, and each chain is reduced in one of two orders:
+ * - Sequential folds the terms left to right exactly as evaluatePostfixExpression does, so results are bit-identical. Only the single-pass reduction over a flat term list is gained.
+ * - Pairwise, opt-in, also flattens right-nested runs and reduces fixed-size blocks of terms with four interleaved accumulators, spreading blocks across threads for very long chains and combining block results in a fixed pairwise tree. Rounding differs from a left fold, but the result depends only on the expression and the values, never on the thread count.
+ */
+
+#ifndef CHAIN_PROGRAM_
+#define CHAIN_PROGRAM_
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "CompiledExpression.h"
+
+class ChainProgram
+{
+public:
+    /** Order in which chain terms are combined. */
+    enum class ReductionOrder
+    {
+        Sequential,  // Left fold, bit-identical to evaluatePostfixExpression
+        Pairwise     // Blocked pairwise tree, deterministic but rounded differently
+    };
+
+    /** Number of terms per block in Pairwise order. */
+    static constexpr size_t BLOCK_SIZE = 4096;
+
+private:
+    /** Kinds of program nodes. */
+    enum class NodeKind : std::uint8_t
+    {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Chain
+    };
+
+    /** A node of the program. Operands and terms always precede the nodes that use them. */
+    struct ChainNode
+    {
+        NodeKind kind;
+        char token;          // Operator character
+        int left;            // Value slots of the operands, or the first term and term count of a chain
+        int right;
+    };
+
+    /** Every operator node. Node i writes value slot VARIABLE_CAPACITY + i, slots 0-5 hold variables a-f. */
+    std::vector<ChainNode> nodes;
+
+    /** Value slot holding the result. */
+    int rootIndex;
+
+    /** Value slots of the terms of every chain, left to right. */
+    std::vector<int> chainTerms;
+
+    /** The reduction order chosen at construction. */
+    ReductionOrder reductionOrder;
+
+    /** Number of threads Pairwise order may use for one chain. */
+    size_t threadCount;
+
+    /** Number of chain nodes. */
+    size_t chainCount;
+
+    /** Number of terms in the longest chain. */
+    size_t longestChain;
+
+    /** Helper function to reduce a range of term values in Pairwise order.
+     * @pre count > 0
+     * @return The reduction of the range. */
+    static double reduceBlock(char operatorChar, const double* nodeValues, const int* terms, size_t count) noexcept;
+
+    /** Helper function to reduce every term of a chain.
+     * @pre The values of every term are computed.
+     * @return The value of the chain. */
+    double reduceChain(const ChainNode& chain, const double* nodeValues) const;
+
+public:
+    /** Builds the program, collapsing runs of + or * with at least minChainLength terms.
+     * @pre None
+     * @post In Sequential order the program computes the same results as evaluatePostfixExpression.
+     * @param expression The compiled expression.
+     * @param order How chain terms are combined.
+     * @param minChainLength Runs with fewer terms are kept as ordinary binary operations. */
+    explicit ChainProgram(const CompiledExpression& expression, ReductionOrder order = ReductionOrder::Sequential, size_t minChainLength = 8);
+
+    /** Sets how many threads Pairwise order may use for one chain. Chains shorter than two blocks always use one.
+     * @pre None
+     * @post Later evaluations use up to threads threads.
+     * @param threads The thread count. Zero uses the number of hardware threads. */
+    void setThreadCount(size_t threads) noexcept;
+
+    /** Evaluates the program.
+     * @pre None
+     * @post The program is unchanged.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression::VariableArray& variableValues) const;
+
+    /** Evaluates the program using caller-provided scratch space, so repeated calls do not allocate.
+     * @pre None
+     * @post nodeValues is overwritten.
+     * @param variableValues The values of variables a-f.
+     * @param nodeValues Scratch space, resized as needed.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<double>& nodeValues) const;
+
+    /** Retrieves the number of collapsed chains.
+     * @return The chain count. */
+    size_t getChainCount() const noexcept;
+
+    /** Retrieves the number of terms in the longest chain.
+     * @return The term count, or 0 if nothing was collapsed. */
+    size_t getLongestChain() const noexcept;
+};
+
+#include "ChainProgram.cpp"
+#endif
@@ -0,0 +1,54 @@
+/** @file ColumnarConverter.cpp
+ * Command line tool that converts a text file of variable rows, six whitespace-separated values a-f per row, into a binary columnar file.
+ * Usage: ColumnarConverter <values.txt> <output.pfxc> [int32|int64|double]
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include <iostream>
+#include "ColumnarVariablesWriter.h"
+
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3 && argc != 4)
+	{
+		cerr << "Usage: " << argv[0] << " <values.txt> <output.pfxc> [int32|int64|double]" << endl;
+		return 1;
+	}
+
+	ColumnarVariables::ColumnType columnType = ColumnarVariables::ColumnType::Int32;
+	if (argc == 4)
+	{
+		string typeName = argv[3];
+		if (typeName == "int64")
+		{
+			columnType = ColumnarVariables::ColumnType::Int64;
+		}
+		else if (typeName == "double")
+		{
+			columnType = ColumnarVariables::ColumnType::Double;
+		}
+		else if (typeName != "int32")
+		{
+			cerr << "Unknown column type: " << typeName << endl;
+			return 1;
+		}
+	}
+
+	try
+	{
+		ColumnarVariablesWriter writer(columnType);
+		size_t rowCount = writer.readTextFile(argv[1]);
+		writer.writeToFile(argv[2]);
+		cout << "Converted " << rowCount << " row(s) from " << argv[1] << " into " << argv[2] << endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		cerr << error.what() << endl;
+		return 1;
+	}
+	return 0;
+}
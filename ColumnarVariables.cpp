@@ -0,0 +1,202 @@
+/** @file ColumnarVariables.cpp
+ * ColumnarVariables validates a binary columnar file of variable rows and evaluates programs over it in place.
+ * @class ColumnarVariables
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ColumnarVariables.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+size_t ColumnarVariables::getValueSize(ColumnType type) noexcept
+{
+    return type == ColumnType::Int32 ? sizeof(std::int32_t) : sizeof(std::int64_t);
+} // end getValueSize
+
+ColumnarVariables::ColumnarVariables(const void* data, size_t size)
+    : fileData(static_cast<const unsigned char*>(data)), header(nullptr), descriptors(nullptr)
+{
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        throw std::runtime_error("Columnar files are read in place, which needs a little-endian host");
+    }
+    if (size < sizeof(ColumnarHeader))
+    {
+        throw std::runtime_error("Columnar file is too small");
+    }
+
+    header = reinterpret_cast<const ColumnarHeader*>(fileData);
+    if (std::string_view(header->magic, 4) != "PFXC")
+    {
+        throw std::runtime_error("Not a columnar variable file");
+    }
+    if (header->version != FORMAT_VERSION)
+    {
+        throw std::runtime_error("Unsupported columnar file version: " + std::to_string(header->version));
+    }
+    if (header->columnType > static_cast<std::uint32_t>(ColumnType::Double))
+    {
+        throw std::runtime_error("Unknown columnar value type: " + std::to_string(header->columnType));
+    }
+
+    // Every column must lie inside the file, computed so that no product can wrap
+    std::uint64_t descriptorsEnd = sizeof(ColumnarHeader) + std::uint64_t(header->columnCount) * sizeof(ColumnDescriptor);
+    size_t valueSize = getValueSize(getColumnType());
+    if (descriptorsEnd > size || header->rowCount > size / valueSize)
+    {
+        throw std::runtime_error("Columnar file section is out of bounds");
+    }
+    descriptors = reinterpret_cast<const ColumnDescriptor*>(fileData + sizeof(ColumnarHeader));
+    std::uint64_t columnBytes = header->rowCount * valueSize;
+    for (std::uint32_t i = 0; i < header->columnCount; ++i)
+    {
+        std::uint64_t offset = descriptors[i].offset;
+        if (offset % COLUMN_ALIGNMENT != 0 || offset < descriptorsEnd || offset > size || columnBytes > size - offset)
+        {
+            throw std::runtime_error("Columnar file column " + std::to_string(i) + " is out of bounds");
+        }
+    }
+} // end constructor
+
+size_t ColumnarVariables::getRowCount() const noexcept
+{
+    return static_cast<size_t>(header->rowCount);
+} // end getRowCount
+
+size_t ColumnarVariables::getColumnCount() const noexcept
+{
+    return header->columnCount;
+} // end getColumnCount
+
+ColumnarVariables::ColumnType ColumnarVariables::getColumnType() const noexcept
+{
+    return static_cast<ColumnType>(header->columnType);
+} // end getColumnType
+
+std::string_view ColumnarVariables::getColumnName(size_t column) const
+{
+    if (column >= header->columnCount)
+    {
+        throw std::out_of_range("Columnar file has no column " + std::to_string(column));
+    }
+    const char* name = descriptors[column].name;
+    return std::string_view(name, std::find(name, name + sizeof(descriptors[column].name), '\0') - name);
+} // end getColumnName
+
+int ColumnarVariables::findColumn(std::string_view name) const noexcept
+{
+    for (std::uint32_t i = 0; i < header->columnCount; ++i)
+    {
+        if (getColumnName(i) == name)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+} // end findColumn
+
+template<class ValueType>
+const ValueType* ColumnarVariables::getColumn(std::string_view name) const
+{
+    constexpr ColumnType requestedType = std::is_same_v<ValueType, std::int32_t> ? ColumnType::Int32
+        : std::is_same_v<ValueType, std::int64_t> ? ColumnType::Int64 : ColumnType::Double;
+    static_assert(std::is_same_v<ValueType, std::int32_t> || std::is_same_v<ValueType, std::int64_t> || std::is_same_v<ValueType, double>,
+        "Columns hold int32, int64 or double values");
+
+    int column = findColumn(name);
+    if (column < 0)
+    {
+        throw std::runtime_error("Columnar file has no column named " + std::string(name));
+    }
+    if (getColumnType() != requestedType)
+    {
+        throw std::runtime_error("Column " + std::string(name) + " holds another value type");
+    }
+    return reinterpret_cast<const ValueType*>(fileData + descriptors[column].offset);
+} // end getColumn
+
+void ColumnarVariables::narrowColumn(size_t column, size_t firstRow, size_t rowCount, std::int32_t* destination) const
+{
+    const unsigned char* columnData = fileData + descriptors[column].offset;
+    if (getColumnType() == ColumnType::Int64)
+    {
+        const std::int64_t* values = reinterpret_cast<const std::int64_t*>(columnData) + firstRow;
+        for (size_t row = 0; row < rowCount; ++row)
+        {
+            if (values[row] < INT_MIN || values[row] > INT_MAX)
+            {
+                throw std::runtime_error("Column value does not fit in an int: " + std::to_string(values[row]));
+            }
+            destination[row] = static_cast<std::int32_t>(values[row]);
+        }
+        return;
+    }
+
+    const double* values = reinterpret_cast<const double*>(columnData) + firstRow;
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        // Variables are integers, so only whole values in range are accepted rather than silently truncated
+        if (!(values[row] >= INT_MIN && values[row] <= INT_MAX) || std::trunc(values[row]) != values[row])
+        {
+            throw std::runtime_error("Column value is not an int: " + std::to_string(values[row]));
+        }
+        destination[row] = static_cast<std::int32_t>(values[row]);
+    }
+} // end narrowColumn
+
+void ColumnarVariables::evaluate(const JitProgram& program, double* results) const
+{
+    std::array<int, CompiledExpression::VARIABLE_CAPACITY> columnOf;
+    bool inPlace = getColumnType() == ColumnType::Int32;
+    for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+    {
+        columnOf[variable] = findColumn(std::string(1, static_cast<char>('a' + variable)));
+        inPlace = inPlace && columnOf[variable] >= 0;
+    }
+
+    const std::int32_t* columns[CompiledExpression::VARIABLE_CAPACITY];
+    size_t rowCount = getRowCount();
+    if (inPlace)
+    {
+        for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+        {
+            columns[variable] = reinterpret_cast<const std::int32_t*>(fileData + descriptors[columnOf[variable]].offset);
+        }
+        program.evaluateColumns(columns, results, rowCount);
+        return;
+    }
+
+    // Missing variables read a block of zeros, other columns are narrowed one block at a time
+    std::vector<std::int32_t> scratch(CompiledExpression::VARIABLE_CAPACITY * BLOCK_ROWS);
+    const std::vector<std::int32_t> zeros(BLOCK_ROWS, 0);
+    for (size_t firstRow = 0; firstRow < rowCount; firstRow += BLOCK_ROWS)
+    {
+        size_t blockRows = std::min(BLOCK_ROWS, rowCount - firstRow);
+        for (size_t variable = 0; variable < CompiledExpression::VARIABLE_CAPACITY; ++variable)
+        {
+            int column = columnOf[variable];
+            if (column < 0)
+            {
+                columns[variable] = zeros.data();
+            }
+            else if (getColumnType() == ColumnType::Int32)
+            {
+                columns[variable] = reinterpret_cast<const std::int32_t*>(fileData + descriptors[column].offset) + firstRow;
+            }
+            else
+            {
+                std::int32_t* destination = scratch.data() + variable * BLOCK_ROWS;
+                narrowColumn(static_cast<size_t>(column), firstRow, blockRows, destination);
+                columns[variable] = destination;
+            }
+        }
+        program.evaluateColumns(columns, results + firstRow, blockRows);
+    }
+} // end evaluate
@@ -0,0 +1,139 @@
+/** @file ColumnarVariables.h
+ * @class ColumnarVariables
+ * Read-only view over a binary file of variable rows stored column by column. The file is meant to be memory-mapped and handed to evaluation directly: int32 columns are passed to JitProgram without parsing or copying, and int64 or double columns are narrowed block by block.
+ *
+ * Layout (little-endian, all offsets relative to the start of the file):
+ * - ColumnarHeader: magic "PFXC", format version, column count, value type shared by every column, and row count.
+ * - One ColumnDescriptor per column: the variable name, padded with zeros, and the offset of the column.
+ * - The columns, each rowCount contiguous values starting on a COLUMN_ALIGNMENT boundary.
+ */
+
+#ifndef COLUMNAR_VARIABLES_
+#define COLUMNAR_VARIABLES_
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "CompiledExpression.h"
+#include "JitProgram.h"
+
+class ColumnarVariables
+{
+public:
+    /** Format version written by ColumnarVariablesWriter and accepted by ColumnarVariables. */
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /** Every column starts at a multiple of this many bytes. */
+    static constexpr std::uint64_t COLUMN_ALIGNMENT = 64;
+
+    /** Number of rows narrowed at a time for columns that are not int32. */
+    static constexpr size_t BLOCK_ROWS = 4096;
+
+    /** Type of every value in the file. */
+    enum class ColumnType : std::uint32_t
+    {
+        Int32 = 0,
+        Int64 = 1,
+        Double = 2
+    };
+
+    /** Fixed-size header at the start of every file. */
+    struct ColumnarHeader
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t columnCount;
+        std::uint32_t columnType;
+        std::uint64_t rowCount;
+        std::uint64_t reserved;
+    };
+
+    /** Name and location of one column. */
+    struct ColumnDescriptor
+    {
+        char name[8];
+        std::uint64_t offset;
+    };
+
+    static_assert(sizeof(ColumnarHeader) == 32, "ColumnarHeader must match the file layout");
+    static_assert(sizeof(ColumnDescriptor) == 16, "ColumnDescriptor must match the file layout");
+
+    /** Retrieves the size of one value of a type.
+     * @param type The column type.
+     * @return The size in bytes. */
+    static size_t getValueSize(ColumnType type) noexcept;
+
+private:
+    /** Start of the file. */
+    const unsigned char* fileData;
+
+    /** The file header. */
+    const ColumnarHeader* header;
+
+    /** The first column descriptor. */
+    const ColumnDescriptor* descriptors;
+
+    /** Helper function to narrow rows of one column into int32 values.
+     * @pre The column holds at least firstRow + rowCount values.
+     * @throws std::runtime_error If a value is not an integer in the int range. */
+    void narrowColumn(size_t column, size_t firstRow, size_t rowCount, std::int32_t* destination) const;
+
+public:
+    /** Validates a file and creates a view over it. The memory must outlive the view.
+     * @pre data points to size readable bytes aligned to at least 8 bytes.
+     * @post The file is unchanged.
+     * @param data Pointer to the start of the file.
+     * @param size Number of bytes in the file.
+     * @throws std::runtime_error If the header, version, type, or any column is out of bounds or misaligned. */
+    ColumnarVariables(const void* data, size_t size);
+
+    /** Retrieves the number of rows.
+     * @return The row count. */
+    size_t getRowCount() const noexcept;
+
+    /** Retrieves the number of columns.
+     * @return The column count. */
+    size_t getColumnCount() const noexcept;
+
+    /** Retrieves the type shared by every column.
+     * @return The column type. */
+    ColumnType getColumnType() const noexcept;
+
+    /** Retrieves the name of a column without copying it.
+     * @pre None
+     * @post The file is unchanged.
+     * @param column The position of the column.
+     * @return The name of the column.
+     * @throws std::out_of_range If there is no such column. */
+    std::string_view getColumnName(size_t column) const;
+
+    /** Finds a column by name.
+     * @pre None
+     * @post The file is unchanged.
+     * @param name The variable name.
+     * @return The position of the column, or -1 if there is none. */
+    int findColumn(std::string_view name) const noexcept;
+
+    /** Retrieves the values of a column in place.
+     * @pre ValueType is std::int32_t, std::int64_t or double.
+     * @post The file is unchanged.
+     * @param name The variable name.
+     * @return Pointer to getRowCount values.
+     * @throws std::runtime_error If there is no such column or it holds another type. */
+    template<class ValueType>
+    const ValueType* getColumn(std::string_view name) const;
+
+    /** Evaluates a program for every row. Variables a-f are taken from the columns with those names, and variables without a column are 0.
+     * When every variable has an int32 column, the mapped columns are passed to the program as they are.
+     * @pre results holds getRowCount values.
+     * @post The file is unchanged.
+     * @param program The program to evaluate.
+     * @param results Receives one result per row.
+     * @throws std::runtime_error If a value is not an integer in the int range.
+     * @throws std::runtime_error If division by zero occurs in any row. */
+    void evaluate(const JitProgram& program, double* results) const;
+};
+
+#include "ColumnarVariables.cpp"
+#endif
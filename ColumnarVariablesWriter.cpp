@@ -0,0 +1,271 @@
+/** @file ColumnarVariablesWriter.cpp
+ * ColumnarVariablesWriter converts rows of variable values into the binary columnar format.
+ * @class ColumnarVariablesWriter
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ColumnarVariablesWriter.h"
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+ColumnarVariablesWriter::ColumnarVariablesWriter(ColumnarVariables::ColumnType type, std::vector<std::string> names)
+    : columnType(type), columnNames(std::move(names)), columns(columnNames.size()), rowCount(0)
+{
+    if (columnNames.empty())
+    {
+        throw std::invalid_argument("A columnar file needs at least one column");
+    }
+    for (const std::string& name : columnNames)
+    {
+        if (name.empty() || name.size() > sizeof(ColumnarVariables::ColumnDescriptor::name))
+        {
+            throw std::invalid_argument("Column names must be 1 to 8 characters: " + name);
+        }
+    }
+} // end constructor
+
+template<class SourceType>
+void ColumnarVariablesWriter::appendValue(size_t column, SourceType value)
+{
+    unsigned char bytes[8];
+    size_t byteCount = ColumnarVariables::getValueSize(columnType);
+    std::uint64_t bits = 0;
+    switch (columnType)
+    {
+    case ColumnarVariables::ColumnType::Int32:
+        if constexpr (std::is_floating_point_v<SourceType>)
+        {
+            // Only whole values in range are accepted rather than silently truncated, as narrowColumn does
+            if (!(value >= INT32_MIN && value <= INT32_MAX) || std::trunc(value) != value)
+            {
+                throw std::runtime_error("Value is not an int32: " + std::to_string(value));
+            }
+        }
+        else if (!std::in_range<std::int32_t>(value))
+        {
+            throw std::runtime_error("Value does not fit in an int32: " + std::to_string(value));
+        }
+        bits = static_cast<std::uint32_t>(static_cast<std::int32_t>(value));
+        break;
+    case ColumnarVariables::ColumnType::Int64:
+        if constexpr (std::is_floating_point_v<SourceType>)
+        {
+            // 2^63 is exact as a double, while INT64_MAX would round up to it
+            if (!(value >= -0x1p63 && value < 0x1p63) || std::trunc(value) != value)
+            {
+                throw std::runtime_error("Value is not an int64: " + std::to_string(value));
+            }
+        }
+        bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+        break;
+    case ColumnarVariables::ColumnType::Double:
+        bits = std::bit_cast<std::uint64_t>(static_cast<double>(value));
+        break;
+    }
+    for (size_t byte = 0; byte < byteCount; ++byte)
+    {
+        bytes[byte] = static_cast<unsigned char>(bits >> (8 * byte));  // Little-endian regardless of the host
+    }
+    columns[column].insert(columns[column].end(), bytes, bytes + byteCount);
+} // end appendValue
+
+template<class SourceType>
+void ColumnarVariablesWriter::appendRow(std::span<const SourceType> values)
+{
+    if (values.size() != columns.size())
+    {
+        throw std::invalid_argument("Row has " + std::to_string(values.size()) + " values for " + std::to_string(columns.size()) + " columns");
+    }
+    size_t column = 0;
+    try
+    {
+        for (; column < columns.size(); ++column)
+        {
+            appendValue(column, values[column]);
+        }
+    }
+    catch (...)
+    {
+        dropPartialRow(column);
+        throw;
+    }
+    ++rowCount;
+} // end appendRow
+
+void ColumnarVariablesWriter::dropPartialRow(size_t columnCount) noexcept
+{
+    for (size_t column = 0; column < columnCount; ++column)
+    {
+        columns[column].resize(rowCount * ColumnarVariables::getValueSize(columnType));
+    }
+} // end dropPartialRow
+
+void ColumnarVariablesWriter::addRow(const std::vector<double>& values)
+{
+    appendRow(std::span<const double>(values));
+} // end addRow
+
+void ColumnarVariablesWriter::addRow(std::span<const std::int64_t> values)
+{
+    appendRow(values);
+} // end addRow
+
+size_t ColumnarVariablesWriter::readTextFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Tokens are parsed straight from the text with from_chars in the column type, so int64 values keep every digit
+    size_t rowsBefore = rowCount;
+    size_t column = 0;
+    const char* current = text.data();
+    const char* end = text.data() + text.size();
+    while (true)
+    {
+        while (current != end && std::isspace(static_cast<unsigned char>(*current)))
+        {
+            ++current;
+        }
+        if (current == end)
+        {
+            break;
+        }
+
+        std::from_chars_result parsed{};
+        switch (columnType)
+        {
+        case ColumnarVariables::ColumnType::Int32:
+        {
+            std::int32_t value = 0;
+            parsed = std::from_chars(current, end, value);
+            if (parsed.ec == std::errc()) appendValue(column, value);
+            break;
+        }
+        case ColumnarVariables::ColumnType::Int64:
+        {
+            std::int64_t value = 0;
+            parsed = std::from_chars(current, end, value);
+            if (parsed.ec == std::errc()) appendValue(column, value);
+            break;
+        }
+        case ColumnarVariables::ColumnType::Double:
+        {
+            double value = 0;
+            parsed = std::from_chars(current, end, value);
+            if (parsed.ec == std::errc()) appendValue(column, value);
+            break;
+        }
+        }
+        if (parsed.ec != std::errc() || (parsed.ptr != end && !std::isspace(static_cast<unsigned char>(*parsed.ptr))))
+        {
+            const char* tokenEnd = current;
+            while (tokenEnd != end && !std::isspace(static_cast<unsigned char>(*tokenEnd)))
+            {
+                ++tokenEnd;
+            }
+            dropPartialRow(column);
+            throw std::runtime_error("Invalid value in " + filename + ": " + std::string(current, tokenEnd));
+        }
+        current = parsed.ptr;
+
+        if (++column == columns.size())
+        {
+            column = 0;
+            ++rowCount;
+        }
+    }
+
+    if (column != 0)
+    {
+        dropPartialRow(column);
+        throw std::runtime_error("File does not contain enough values.");
+    }
+    return rowCount - rowsBefore;
+} // end readTextFile
+
+size_t ColumnarVariablesWriter::getRowCount() const noexcept
+{
+    return rowCount;
+} // end getRowCount
+
+std::vector<unsigned char> ColumnarVariablesWriter::buildHead() const
+{
+    // The header and descriptors, with each column placed on the next aligned offset after the previous one
+    std::vector<unsigned char> head(sizeof(ColumnarVariables::ColumnarHeader) + columns.size() * sizeof(ColumnarVariables::ColumnDescriptor));
+
+    ColumnarVariables::ColumnarHeader header{};
+    std::memcpy(header.magic, "PFXC", 4);
+    header.version = ColumnarVariables::FORMAT_VERSION;
+    header.columnCount = static_cast<std::uint32_t>(columns.size());
+    header.columnType = static_cast<std::uint32_t>(columnType);
+    header.rowCount = rowCount;
+    std::memcpy(head.data(), &header, sizeof(header));
+
+    std::uint64_t offset = head.size();
+    for (size_t column = 0; column < columns.size(); ++column)
+    {
+        offset = (offset + ColumnarVariables::COLUMN_ALIGNMENT - 1) / ColumnarVariables::COLUMN_ALIGNMENT * ColumnarVariables::COLUMN_ALIGNMENT;
+        ColumnarVariables::ColumnDescriptor descriptor{};
+        std::memcpy(descriptor.name, columnNames[column].data(), columnNames[column].size());
+        descriptor.offset = offset;
+        std::memcpy(head.data() + sizeof(header) + column * sizeof(descriptor), &descriptor, sizeof(descriptor));
+        offset += columns[column].size();
+    }
+    return head;
+} // end buildHead
+
+std::uint64_t ColumnarVariablesWriter::getColumnOffset(const std::vector<unsigned char>& head, size_t column) noexcept
+{
+    ColumnarVariables::ColumnDescriptor descriptor;
+    std::memcpy(&descriptor, head.data() + sizeof(ColumnarVariables::ColumnarHeader) + column * sizeof(descriptor), sizeof(descriptor));
+    return descriptor.offset;
+} // end getColumnOffset
+
+std::vector<unsigned char> ColumnarVariablesWriter::build() const
+{
+    std::vector<unsigned char> fileBytes = buildHead();
+    for (size_t column = 0; column < columns.size(); ++column)
+    {
+        fileBytes.resize(static_cast<size_t>(getColumnOffset(fileBytes, column)), 0);
+        fileBytes.insert(fileBytes.end(), columns[column].begin(), columns[column].end());
+    }
+    return fileBytes;
+} // end build
+
+void ColumnarVariablesWriter::writeToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    std::vector<unsigned char> head = buildHead();
+    file.write(reinterpret_cast<const char*>(head.data()), static_cast<std::streamsize>(head.size()));
+    std::uint64_t written = head.size();
+
+    static const char padding[ColumnarVariables::COLUMN_ALIGNMENT] = {};
+    for (size_t column = 0; column < columns.size(); ++column)
+    {
+        std::uint64_t offset = getColumnOffset(head, column);
+        file.write(padding, static_cast<std::streamsize>(offset - written));
+        file.write(reinterpret_cast<const char*>(columns[column].data()), static_cast<std::streamsize>(columns[column].size()));
+        written = offset + columns[column].size();
+    }
+    if (!file)
+    {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+} // end writeToFile
@@ -0,0 +1,111 @@
+/** @file ColumnarVariablesWriter.h
+ * @class ColumnarVariablesWriter
+ * Collects rows of variable values and serializes them into the binary columnar format read by ColumnarVariables. Rows can be added directly or parsed from the whitespace-separated text format read by readValuesFromFile.
+ */
+
+#ifndef COLUMNAR_VARIABLES_WRITER_
+#define COLUMNAR_VARIABLES_WRITER_
+
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+#include "ColumnarVariables.h"
+
+class ColumnarVariablesWriter
+{
+private:
+    /** Type of every value written. */
+    ColumnarVariables::ColumnType columnType;
+
+    /** Name of each column. */
+    std::vector<std::string> columnNames;
+
+    /** Little-endian bytes of each column. */
+    std::vector<std::vector<unsigned char>> columns;
+
+    /** Number of rows added so far. */
+    size_t rowCount;
+
+    /** Helper function to append one value to a column in the column type.
+     * @pre column < columns.size()
+     * @throw std::runtime_error If the column type is an integer and the value is not a whole number in its range. Nothing is appended. */
+    template<class SourceType>
+    void appendValue(size_t column, SourceType value);
+
+    /** Helper function to add one row of values of any type.
+     * @pre None
+     * @post The row follows the rows added before it, or nothing is added if an exception is thrown.
+     * @throw std::invalid_argument If the number of values is not the number of columns.
+     * @throw std::runtime_error If a value does not fit in the column type. */
+    template<class SourceType>
+    void appendRow(std::span<const SourceType> values);
+
+    /** Helper function to remove the values of a row that was not completed.
+     * @pre Each of the first columnCount columns holds one value past rowCount.
+     * @post Every column holds rowCount values. */
+    void dropPartialRow(size_t columnCount) noexcept;
+
+    /** Helper function to lay out the header and column descriptors.
+     * @return The bytes of the header and descriptors, without padding. */
+    std::vector<unsigned char> buildHead() const;
+
+    /** Helper function to read the offset of a column from the bytes made by buildHead.
+     * @return The offset of the column from the start of the file. */
+    static std::uint64_t getColumnOffset(const std::vector<unsigned char>& head, size_t column) noexcept;
+
+public:
+    /** Creates a writer for columns of one type.
+     * @pre None
+     * @post The writer holds no rows.
+     * @param type The type of every value.
+     * @param names The name of each column, at most 8 characters. Defaults to variables a-f.
+     * @throw std::invalid_argument If there are no names or a name is empty or longer than 8 characters. */
+    explicit ColumnarVariablesWriter(ColumnarVariables::ColumnType type,
+        std::vector<std::string> names = { "a", "b", "c", "d", "e", "f" });
+
+    /** Adds one row.
+     * @pre None
+     * @post The row follows the rows added before it, or nothing is added if an exception is thrown.
+     * @param values The values of the row, in column order.
+     * @throw std::invalid_argument If there is not one value per column.
+     * @throw std::runtime_error If the columns are integers and a value is not a whole number in their range. */
+    void addRow(const std::vector<double>& values);
+
+    /** Adds one row of integers, keeping every digit of int64 values that a double would round.
+     * @pre None
+     * @post The row follows the rows added before it, or nothing is added if an exception is thrown.
+     * @param values The values of the row, in column order.
+     * @throw std::invalid_argument If there is not one value per column.
+     * @throw std::runtime_error If the columns are int32 and a value is out of their range. */
+    void addRow(std::span<const std::int64_t> values);
+
+    /** Parses rows of whitespace-separated values, one value per column per row, as readValuesFromFile does for a single row.
+     * @pre None
+     * @post Every complete row of the file is added. A row cut short by an error is dropped.
+     * @param filename The name of the text file.
+     * @return The number of rows added.
+     * @throw std::runtime_error If the file cannot be opened, a value cannot be parsed as the column type, or the last row is incomplete. */
+    size_t readTextFile(const std::string& filename);
+
+    /** Retrieves the number of rows added so far.
+     * @return The row count. */
+    size_t getRowCount() const noexcept;
+
+    /** Serializes every row into a columnar file.
+     * @pre None
+     * @post The writer is unchanged.
+     * @return The bytes of the file. */
+    std::vector<unsigned char> build() const;
+
+    /** Serializes every row into a columnar file on disk, writing the columns one after another without assembling the whole file in memory.
+     * @pre None
+     * @post The file holds the columns, replacing any previous contents.
+     * @param filename The name of the file to write.
+     * @throw std::runtime_error If the file cannot be written. */
+    void writeToFile(const std::string& filename) const;
+};
+
+#include "ColumnarVariablesWriter.cpp"
+#endif
@@ -0,0 +1,107 @@
+/** @file CompiledExpression.cpp
+ * CompiledExpression validates a postfix expression and lowers it to an expression tree and bytecode.
+ * @class CompiledExpression
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "CompiledExpression.h"
+
+CompiledExpression::CompiledExpression(const std::string& postfixExpression)
+    : postfixExpression(postfixExpression), astRoot(-1), maxStackDepth(0), referencedVariables(0)
+{
+    std::vector<int> nodeStack;  // Arena indices of operands not yet consumed
+    astArena.reserve(postfixExpression.size());
+    bytecode.reserve(postfixExpression.size());
+
+    for (char currentChar : postfixExpression)
+    {
+        if (currentChar >= 'a' && currentChar < 'a' + static_cast<int>(VARIABLE_CAPACITY))  // Operand
+        {
+            nodeStack.push_back(static_cast<int>(astArena.size()));
+            astArena.push_back(AstNode{ currentChar, -1, -1 });
+            bytecode.push_back(static_cast<std::uint8_t>(currentChar - 'a'));
+            referencedVariables |= static_cast<std::uint8_t>(1u << (currentChar - 'a'));
+        }
+        else  // Operator, checked in the same order evaluatePostfixExpression reports errors
+        {
+            if (nodeStack.size() < 2) throw std::runtime_error("Invalid postfix expression");
+
+            Opcode operation;
+            switch (currentChar)
+            {
+            case '+': operation = Opcode::Add; break;
+            case '-': operation = Opcode::Subtract; break;
+            case '*': operation = Opcode::Multiply; break;
+            case '/': operation = Opcode::Divide; break;
+            default:
+                throw std::runtime_error("Unknown operator encountered");
+            }
+
+            int right = nodeStack.back();
+            nodeStack.pop_back();
+            int left = nodeStack.back();
+            nodeStack.pop_back();
+
+            nodeStack.push_back(static_cast<int>(astArena.size()));
+            astArena.push_back(AstNode{ currentChar, left, right });
+            bytecode.push_back(static_cast<std::uint8_t>(operation));
+        }
+
+        if (nodeStack.size() > maxStackDepth)
+        {
+            maxStackDepth = nodeStack.size();
+        }
+    }
+
+    // The expression must leave exactly one result
+    if (nodeStack.size() != 1) throw std::runtime_error("Invalid postfix expression");
+
+    astRoot = nodeStack.back();
+} // end constructor
+
+double CompiledExpression::applyOperator(char operatorChar, double operand1, double operand2)
+{
+    switch (operatorChar)
+    {
+    case '+': return operand1 + operand2;
+    case '-': return operand1 - operand2;
+    case '*': return operand1 * operand2;
+    case '/':
+        if (operand2 == 0) throw std::runtime_error("Division by zero");
+        return operand1 / operand2;
+    default:
+        throw std::runtime_error("Unknown operator encountered");
+    }
+} // end applyOperator
+
+const std::string& CompiledExpression::getPostfixExpression() const noexcept
+{
+    return postfixExpression;
+} // end getPostfixExpression
+
+const std::vector<CompiledExpression::AstNode>& CompiledExpression::getAstArena() const noexcept
+{
+    return astArena;
+} // end getAstArena
+
+int CompiledExpression::getAstRoot() const noexcept
+{
+    return astRoot;
+} // end getAstRoot
+
+const std::vector<std::uint8_t>& CompiledExpression::getBytecode() const noexcept
+{
+    return bytecode;
+} // end getBytecode
+
+size_t CompiledExpression::getMaxStackDepth() const noexcept
+{
+    return maxStackDepth;
+} // end getMaxStackDepth
+
+std::uint8_t CompiledExpression::getReferencedVariables() const noexcept
+{
+    return referencedVariables;
+} // end getReferencedVariables
@@ -0,0 +1,121 @@
+/** @file CompiledExpression.h
+ * @class CompiledExpression
+ * Declaration of the CompiledExpression class, an immutable, validated form of a postfix expression that every execution backend can run. It keeps the postfix tokens, a flat arena-allocated expression tree, and a compact bytecode stream.
+ */
+
+#ifndef COMPILED_EXPRESSION_
+#define COMPILED_EXPRESSION_
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class CompiledExpression
+{
+public:
+    /** Number of variables (a-f) an expression can reference. */
+    static constexpr size_t VARIABLE_CAPACITY = 6;
+
+    /** Values of variables a-f used during evaluation. */
+    using VariableArray = std::array<int, VARIABLE_CAPACITY>;
+
+    /** One-byte bytecode instructions. LoadA through LoadF push the value of a variable, the remaining opcodes pop two operands and push the result. */
+    enum class Opcode : std::uint8_t
+    {
+        LoadA, LoadB, LoadC, LoadD, LoadE, LoadF,
+        Add, Subtract, Multiply, Divide
+    };
+
+    /** A node of the flat expression tree. Leaves hold a variable token, interior nodes hold an operator token and the arena indices of their operands. */
+    struct AstNode
+    {
+        /** The variable or operator character of this node. */
+        char token;
+
+        /** Arena index of the left operand, or -1 for a leaf. */
+        int left;
+
+        /** Arena index of the right operand, or -1 for a leaf. */
+        int right;
+    };
+
+private:
+    /** The postfix tokens the expression was compiled from. */
+    std::string postfixExpression;
+
+    /** Arena holding every tree node. Operands always precede the operators that use them. */
+    std::vector<AstNode> astArena;
+
+    /** Arena index of the root node. */
+    int astRoot;
+
+    /** Compact bytecode, one Opcode per postfix token. */
+    std::vector<std::uint8_t> bytecode;
+
+    /** Largest number of operands held on the stack while evaluating. */
+    size_t maxStackDepth;
+
+    /** Bit i is set if variable 'a' + i appears in the expression. */
+    std::uint8_t referencedVariables;
+
+public:
+    /** Compiles and validates a postfix expression.
+     * @pre None
+     * @post The expression is stored as postfix tokens, an expression tree, and bytecode.
+     * @param postfixExpression A postfix expression using operands a-f and operators +,-,*,/.
+     * @throws std::runtime_error If the postfix expression is invalid.
+     * @throws std::runtime_error If an unknown operator is encountered. */
+    explicit CompiledExpression(const std::string& postfixExpression);
+
+    /** Performs a single arithmetic operation the same way evaluatePostfixExpression does.
+     * @pre None
+     * @post None
+     * @param operatorChar The operator character to apply.
+     * @param operand1 The left operand.
+     * @param operand2 The right operand.
+     * @return The result of the operation.
+     * @throws std::runtime_error If an unknown operator is encountered.
+     * @throws std::runtime_error If division by zero occurs. */
+    static double applyOperator(char operatorChar, double operand1, double operand2);
+
+    /** Retrieves the postfix tokens of this expression.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return The postfix expression as a string. */
+    const std::string& getPostfixExpression() const noexcept;
+
+    /** Retrieves the arena of expression tree nodes.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return The arena of tree nodes. */
+    const std::vector<AstNode>& getAstArena() const noexcept;
+
+    /** Retrieves the arena index of the root of the expression tree.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return The arena index of the root node. */
+    int getAstRoot() const noexcept;
+
+    /** Retrieves the bytecode of this expression.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return The bytecode instruction stream. */
+    const std::vector<std::uint8_t>& getBytecode() const noexcept;
+
+    /** Retrieves the largest stack depth needed to evaluate this expression.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return The maximum number of operands on the stack at once. */
+    size_t getMaxStackDepth() const noexcept;
+
+    /** Retrieves which variables the expression reads.
+     * @pre None
+     * @post The expression is unchanged.
+     * @return A bit mask where bit i is set if variable 'a' + i appears in the expression. */
+    std::uint8_t getReferencedVariables() const noexcept;
+};
+
+#include "CompiledExpression.cpp"
+#endif
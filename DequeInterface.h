@@ -1,21 +1,17 @@
 /** @file DequeInterface.h
  * @class DequeInterface
- * Interface for classes of a deque that allow enqueueing and dequeueing elements from both the front and back of the deque.
+ * Interface for classes of a deque that allow enqueueing and dequeueing elements from both the front and back of the deque. The read operations come from DequeReadInterface.
  */
 
 #ifndef DEQUE_INTERFACE_
 #define DEQUE_INTERFACE_
 
+#include "DequeReadInterface.h"
+
 template<class ItemType>
-class DequeInterface
+class DequeInterface : public DequeReadInterface<ItemType>
 {
 public:
-    /** Sees whether this deque is empty.
-     * @pre None
-     * @post The deque is unchanged.
-     * @return True if the deque is empty, or false if not. */
-    virtual bool isEmpty() const = 0;
-
     /** Adds a new entry to the front of this deque.
      * @pre None
      * @post If the operation was successful, newEntry is at the front of the deque.
@@ -42,17 +38,17 @@ public:
      * @return True if the removal is successful or false if not. */
     virtual bool dequeueBack() = 0;
 
-    /** Returns a copy of the front of this deque.
+    /** Removes the front of this deque and returns it.
      * @pre The deque is not empty.
-     * @post A copy of the front of the deque has been returned, and the deque is unchanged.
-     * @return A copy of the front of the deque. */
-    virtual ItemType peekFront() const = 0;
+     * @post If the operation was successful, the front of the deque has been removed.
+     * @return The former front of the deque, moved out of the deque. */
+    virtual ItemType popFront() = 0;
 
-    /** Returns a copy of the back of this deque.
+    /** Removes the back of this deque and returns it.
      * @pre The deque is not empty.
-     * @post A copy of the back of the deque has been returned, and the deque is unchanged.
-     * @return A copy of the back of the deque. */
-    virtual ItemType peekBack() const = 0;
+     * @post If the operation was successful, the back of the deque has been removed.
+     * @return The former back of the deque, moved out of the deque. */
+    virtual ItemType popBack() = 0;
 
     /** Clears all entries in the deque.
      * @pre None
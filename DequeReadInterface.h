@@ -0,0 +1,37 @@
+/** @file DequeReadInterface.h
+ * @class DequeReadInterface
+ * Interface for the read side of a deque: checking for emptiness and peeking at either end. Implemented by mutable deques through DequeInterface and by immutable deques directly.
+ */
+
+#ifndef DEQUE_READ_INTERFACE_
+#define DEQUE_READ_INTERFACE_
+
+template<class ItemType>
+class DequeReadInterface
+{
+public:
+    /** Sees whether this deque is empty.
+     * @pre None
+     * @post The deque is unchanged.
+     * @return True if the deque is empty, or false if not. */
+    virtual bool isEmpty() const = 0;
+
+    /** Returns a copy of the front of this deque.
+     * @pre The deque is not empty.
+     * @post A copy of the front of the deque has been returned, and the deque is unchanged.
+     * @return A copy of the front of the deque. */
+    virtual ItemType peekFront() const = 0;
+
+    /** Returns a copy of the back of this deque.
+     * @pre The deque is not empty.
+     * @post A copy of the back of the deque has been returned, and the deque is unchanged.
+     * @return A copy of the back of the deque. */
+    virtual ItemType peekBack() const = 0;
+
+    /** Destroys this deque and frees its assigned memory.
+     * @pre None
+     * @post All memory associated with this deque has been released. */
+    virtual ~DequeReadInterface() { }
+};  // end DequeReadInterface
+
+#endif
@@ -0,0 +1,39 @@
+/** @file EvaluationContext.cpp
+ * EvaluationContext evaluates shared compiled expressions with per-thread scratch space.
+ * @class EvaluationContext
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "EvaluationContext.h"
+#include "BytecodeBackend.h"
+
+EvaluationContext::EvaluationContext()
+    : scratchStack(DEFAULT_STACK_DEPTH), variableValues{}
+{ } // end default constructor
+
+EvaluationContext::EvaluationContext(const CompiledExpression::VariableArray& values)
+    : scratchStack(DEFAULT_STACK_DEPTH), variableValues(values)
+{ } // end constructor
+
+void EvaluationContext::setVariableValues(const CompiledExpression::VariableArray& values) noexcept
+{
+    variableValues = values;
+} // end setVariableValues
+
+const CompiledExpression::VariableArray& EvaluationContext::getVariableValues() const noexcept
+{
+    return variableValues;
+} // end getVariableValues
+
+double EvaluationContext::evaluate(const CompiledExpression& expression)
+{
+    if (expression.getMaxStackDepth() > scratchStack.size())
+    {
+        scratchStack.resize(expression.getMaxStackDepth());
+    }
+
+    const std::vector<std::uint8_t>& bytecode = expression.getBytecode();
+    return BytecodeBackend::run(bytecode.data(), bytecode.size(), scratchStack.data(), variableValues);
+} // end evaluate
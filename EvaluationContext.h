@@ -0,0 +1,56 @@
+/** @file EvaluationContext.h
+ * @class EvaluationContext
+ * Per-thread state for evaluating compiled expressions. A CompiledExpression is immutable once built, so one instance can be shared by any number of threads; each thread keeps its own EvaluationContext holding the variable values and the scratch operand stack. Evaluating through a context takes no locks and, once the scratch stack is as deep as the deepest program seen, allocates nothing.
+ */
+
+#ifndef EVALUATION_CONTEXT_
+#define EVALUATION_CONTEXT_
+
+#include <vector>
+#include "CompiledExpression.h"
+
+class EvaluationContext
+{
+private:
+    /** Scratch space for the operand stack, reused across evaluations. */
+    std::vector<double> scratchStack;
+
+    /** The values of variables a-f. */
+    CompiledExpression::VariableArray variableValues;
+
+public:
+    /** Scratch stack depth reserved up front. */
+    static constexpr size_t DEFAULT_STACK_DEPTH = 64;
+
+    /** Creates a context with every variable set to 0.
+     * @pre None
+     * @post The scratch stack holds DEFAULT_STACK_DEPTH operands. */
+    EvaluationContext();
+
+    /** Creates a context with the given variable values.
+     * @pre None
+     * @post The scratch stack holds DEFAULT_STACK_DEPTH operands.
+     * @param values The values of variables a-f. */
+    explicit EvaluationContext(const CompiledExpression::VariableArray& values);
+
+    /** Replaces every variable value at once.
+     * @pre None
+     * @post variableValues holds the given values.
+     * @param values The values of variables a-f. */
+    void setVariableValues(const CompiledExpression::VariableArray& values) noexcept;
+
+    /** Retrieves the variable values used for evaluation.
+     * @return The values of variables a-f. */
+    const CompiledExpression::VariableArray& getVariableValues() const noexcept;
+
+    /** Evaluates a shared compiled expression with this context's variable values.
+     * @pre None
+     * @post The expression is unchanged. The scratch stack grows if the expression is deeper than any seen before.
+     * @param expression The compiled expression to evaluate.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression& expression);
+};
+
+#include "EvaluationContext.cpp"
+#endif
@@ -0,0 +1,25 @@
+/** @file ExecutionBackendFactory.cpp
+ * ExecutionBackendFactory creates execution backends by kind.
+ * @class ExecutionBackendFactory
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ExecutionBackendFactory.h"
+
+std::shared_ptr<const ExecutionBackendInterface> ExecutionBackendFactory::create(ExecutionBackendKind kind)
+{
+    switch (kind)
+    {
+    case ExecutionBackendKind::StackReplay: return std::make_shared<StackReplayBackend>();
+    case ExecutionBackendKind::TreeWalk: return std::make_shared<TreeWalkBackend>();
+    case ExecutionBackendKind::Bytecode: return std::make_shared<BytecodeBackend>();
+    }
+    throw std::invalid_argument("Unknown execution backend");
+} // end create
+
+std::vector<ExecutionBackendKind> ExecutionBackendFactory::getAllKinds()
+{
+    return { ExecutionBackendKind::StackReplay, ExecutionBackendKind::TreeWalk, ExecutionBackendKind::Bytecode };
+} // end getAllKinds
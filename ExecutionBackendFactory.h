@@ -0,0 +1,42 @@
+/** @file ExecutionBackendFactory.h
+ * @class ExecutionBackendFactory
+ * Creates execution backends by kind so the backend used for evaluation can be chosen at runtime.
+ */
+
+#ifndef EXECUTION_BACKEND_FACTORY_
+#define EXECUTION_BACKEND_FACTORY_
+
+#include <memory>
+#include <vector>
+#include "StackReplayBackend.h"
+#include "TreeWalkBackend.h"
+#include "BytecodeBackend.h"
+
+/** The available execution backends. */
+enum class ExecutionBackendKind
+{
+    StackReplay,
+    TreeWalk,
+    Bytecode
+};
+
+class ExecutionBackendFactory
+{
+public:
+    /** Creates an execution backend.
+     * @pre None
+     * @post None
+     * @param kind The kind of backend to create.
+     * @return A shared pointer to the new backend.
+     * @throws std::invalid_argument If the kind is not recognized. */
+    static std::shared_ptr<const ExecutionBackendInterface> create(ExecutionBackendKind kind);
+
+    /** Lists every available backend kind.
+     * @pre None
+     * @post None
+     * @return All backend kinds, in declaration order. */
+    static std::vector<ExecutionBackendKind> getAllKinds();
+};
+
+#include "ExecutionBackendFactory.cpp"
+#endif
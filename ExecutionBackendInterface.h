@@ -0,0 +1,36 @@
+/** @file ExecutionBackendInterface.h
+ * @class ExecutionBackendInterface
+ * Interface for classes that execute a compiled expression against a set of variable values. */
+
+#ifndef EXECUTION_BACKEND_INTERFACE_
+#define EXECUTION_BACKEND_INTERFACE_
+
+#include <memory_resource>
+#include <string>
+#include "CompiledExpression.h"
+
+class ExecutionBackendInterface
+{
+public:
+    /** Evaluates a compiled expression.
+     * @pre None
+     * @post The expression and variable values are unchanged.
+     * @param expression The compiled expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @param resource Memory resource for the backend's scratch storage, such as the caller's per-request arena.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    virtual double execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+        std::pmr::memory_resource* resource) const = 0;
+
+    /** Retrieves the name of this backend.
+     * @pre None
+     * @post None
+     * @return A short name identifying the backend. */
+    virtual std::string getName() const = 0;
+
+    /** Virtual destructor for the interface. */
+    virtual ~ExecutionBackendInterface() = default;
+};
+
+#endif
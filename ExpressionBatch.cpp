@@ -0,0 +1,137 @@
+/** @file ExpressionBatch.cpp
+ * ExpressionBatch hash-conses a batch of postfix expressions into a shared DAG and evaluates it one variable row at a time.
+ * @class ExpressionBatch
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ExpressionBatch.h"
+#include <stdexcept>
+#include <utility>
+
+ExpressionBatch::ExpressionBatch() : totalOperationCount(0), uniqueOperationCount(0)
+{ } // end default constructor
+
+int ExpressionBatch::internNode(char token, int left, int right)
+{
+    // + and * are commutative, so a+b and b+a share one node. IEEE addition and multiplication give the same result in either order.
+    if ((token == '+' || token == '*') && left > right)
+    {
+        std::swap(left, right);
+    }
+
+    // Node indices are limited to 28 bits so the key fits in 64 bits
+    constexpr std::uint64_t INDEX_LIMIT = std::uint64_t(1) << 28;
+    if (nodes.size() >= INDEX_LIMIT)
+    {
+        throw std::length_error("Expression batch has too many distinct subexpressions");
+    }
+    std::uint64_t key = (std::uint64_t(static_cast<unsigned char>(token)) << 56) |
+        (std::uint64_t(left + 1) << 28) | std::uint64_t(right + 1);
+
+    auto existing = nodeLookup.find(key);
+    if (existing != nodeLookup.end())
+    {
+        return existing->second;
+    }
+
+    int nodeIndex = static_cast<int>(nodes.size());
+    nodes.push_back(DagNode{ token, left, right });
+    nodeLookup.emplace(key, nodeIndex);
+    if (left >= 0)
+    {
+        ++uniqueOperationCount;
+    }
+    return nodeIndex;
+} // end internNode
+
+size_t ExpressionBatch::addFormula(const std::string& postfixExpression)
+{
+    // Validate first so a rejected formula leaves no nodes behind
+    CompiledExpression compiled(postfixExpression);
+
+    std::vector<int> nodeStack;
+    for (char currentChar : compiled.getPostfixExpression())
+    {
+        if (currentChar >= 'a' && currentChar <= 'z')
+        {
+            nodeStack.push_back(internNode(currentChar, -1, -1));
+        }
+        else
+        {
+            int right = nodeStack.back();
+            nodeStack.pop_back();
+            int left = nodeStack.back();
+            nodeStack.pop_back();
+            nodeStack.push_back(internNode(currentChar, left, right));
+            ++totalOperationCount;
+        }
+    }
+
+    formulaRoots.push_back(nodeStack.back());
+    return formulaRoots.size() - 1;
+} // end addFormula
+
+void ExpressionBatch::evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<FormulaResult>& results)
+{
+    nodeValues.resize(nodes.size());
+    nodeFailed.resize(nodes.size());
+
+    // Nodes are stored in dependency order, so one forward pass computes every subexpression once
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const DagNode& node = nodes[i];
+        if (node.left < 0)
+        {
+            nodeValues[i] = variableValues[node.token - 'a'];
+            nodeFailed[i] = false;
+            continue;
+        }
+
+        double operand1 = nodeValues[node.left];
+        double operand2 = nodeValues[node.right];
+        if (nodeFailed[node.left] || nodeFailed[node.right] || (node.token == '/' && operand2 == 0))
+        {
+            nodeFailed[i] = true;
+            continue;
+        }
+
+        nodeFailed[i] = false;
+        switch (node.token)
+        {
+        case '+': nodeValues[i] = operand1 + operand2; break;
+        case '-': nodeValues[i] = operand1 - operand2; break;
+        case '*': nodeValues[i] = operand1 * operand2; break;
+        default: nodeValues[i] = operand1 / operand2; break;
+        }
+    }
+
+    // Fan the shared results out to every formula
+    results.resize(formulaRoots.size());
+    for (size_t i = 0; i < formulaRoots.size(); ++i)
+    {
+        int root = formulaRoots[i];
+        results[i] = FormulaResult{ nodeValues[root], !nodeFailed[root] };
+    }
+} // end evaluate
+
+size_t ExpressionBatch::getFormulaCount() const noexcept
+{
+    return formulaRoots.size();
+} // end getFormulaCount
+
+size_t ExpressionBatch::getTotalOperationCount() const noexcept
+{
+    return totalOperationCount;
+} // end getTotalOperationCount
+
+size_t ExpressionBatch::getUniqueOperationCount() const noexcept
+{
+    return uniqueOperationCount;
+} // end getUniqueOperationCount
+
+size_t ExpressionBatch::getDeduplicatedOperationCount() const noexcept
+{
+    return totalOperationCount - uniqueOperationCount;
+} // end getDeduplicatedOperationCount
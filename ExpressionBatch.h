@@ -0,0 +1,95 @@
+/** @file ExpressionBatch.h
+ * @class ExpressionBatch
+ * Compiles a batch of postfix expressions into one shared expression DAG. Identical subexpressions are hash-consed into a single node, with the operands of + and * put in a canonical order, so each distinct subexpression is computed once per variable row and shared by every formula that uses it.
+ */
+
+#ifndef EXPRESSION_BATCH_
+#define EXPRESSION_BATCH_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CompiledExpression.h"
+#include "FormulaResult.h"
+
+class ExpressionBatch
+{
+private:
+    /** A node of the shared DAG. Leaves hold a variable token and have no operands. */
+    struct DagNode
+    {
+        char token;
+        int left;
+        int right;
+    };
+
+    /** Every distinct subexpression. Operands always precede the operators that use them. */
+    std::vector<DagNode> nodes;
+
+    /** Maps a packed (token, left, right) key to the node holding that subexpression. */
+    std::unordered_map<std::uint64_t, int> nodeLookup;
+
+    /** DAG node holding the result of each formula. */
+    std::vector<int> formulaRoots;
+
+    /** Number of operators in all formulas before sharing. */
+    size_t totalOperationCount;
+
+    /** Number of operator nodes in the DAG. */
+    size_t uniqueOperationCount;
+
+    /** Scratch value of every node, reused between rows. */
+    std::vector<double> nodeValues;
+
+    /** Scratch flag of every node that divided by zero or depends on one that did, reused between rows. */
+    std::vector<char> nodeFailed;
+
+    /** Helper function to find or create the node for a subexpression.
+     * @pre left and right are existing node indices, or -1 for a leaf.
+     * @post The DAG holds exactly one node for the subexpression.
+     * @param token The variable or operator character.
+     * @param left The node of the left operand.
+     * @param right The node of the right operand.
+     * @return The index of the node. */
+    int internNode(char token, int left, int right);
+
+public:
+    /** Creates an empty batch. */
+    ExpressionBatch();
+
+    /** Adds a formula to the batch, sharing every subexpression already in the DAG.
+     * @pre None
+     * @post The formula is the last formula of the batch.
+     * @param postfixExpression A postfix expression produced by convertInfixToPostfix.
+     * @return The position of the formula in the batch.
+     * @throws std::runtime_error If the postfix expression is invalid.
+     * @throws std::runtime_error If an unknown operator is encountered. */
+    size_t addFormula(const std::string& postfixExpression);
+
+    /** Evaluates every formula of the batch on one variable row, computing each distinct subexpression once.
+     * @pre None
+     * @post results holds one entry per formula, in the order they were added. Not safe to call concurrently on one batch.
+     * @param variableValues The values of variables a-f.
+     * @param results Receives the result of each formula. */
+    void evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<FormulaResult>& results);
+
+    /** Retrieves the number of formulas in the batch.
+     * @return The number of formulas. */
+    size_t getFormulaCount() const noexcept;
+
+    /** Retrieves the number of operators in all formulas before sharing.
+     * @return The total number of operations. */
+    size_t getTotalOperationCount() const noexcept;
+
+    /** Retrieves the number of operators actually computed per row.
+     * @return The number of distinct operations. */
+    size_t getUniqueOperationCount() const noexcept;
+
+    /** Retrieves the number of operations removed by sharing subexpressions.
+     * @return The total number of operations minus the number of distinct operations. */
+    size_t getDeduplicatedOperationCount() const noexcept;
+};
+
+#include "ExpressionBatch.cpp"
+#endif
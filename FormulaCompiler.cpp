@@ -0,0 +1,94 @@
+/** @file FormulaCompiler.cpp
+ * Command line tool that compiles a text file of infix formulas, one per line, into a binary program image.
+ * Usage: FormulaCompiler <formulas.txt> <output.pfxp>
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include <iostream>
+#include "InfixToPostfixEvaluation.h"
+#include "ProgramImageWriter.h"
+
+using namespace std;
+
+/** Returns true if every closing parenthesis has an opening one, which convertInfixToPostfix requires. */
+bool parenthesesBalanced(const string& infixExpr)
+{
+	int depth = 0;
+	for (char currentChar : infixExpr)
+	{
+		depth += currentChar == '(' ? 1 : currentChar == ')' ? -1 : 0;
+		if (depth < 0)
+		{
+			return false;
+		}
+	}
+	return depth == 0;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3)
+	{
+		cerr << "Usage: " << argv[0] << " <formulas.txt> <output.pfxp>" << endl;
+		return 1;
+	}
+
+	ifstream formulaFile(argv[1]);
+	if (!formulaFile)
+	{
+		cerr << "Could not open file: " << argv[1] << endl;
+		return 1;
+	}
+
+	InfixToPostfixEvaluation evaluator;
+	ProgramImageWriter writer;
+	string infixExpr;
+	size_t lineNumber = 0;
+	size_t failures = 0;
+
+	while (getline(formulaFile, infixExpr))
+	{
+		++lineNumber;
+		if (!infixExpr.empty() && infixExpr.back() == '\r')
+		{
+			infixExpr.pop_back();  // Accept files with Windows line endings
+		}
+		if (infixExpr.find_first_not_of(" \t") == string::npos)
+		{
+			continue;  // Skip blank lines
+		}
+
+		try
+		{
+			if (!parenthesesBalanced(infixExpr)) throw std::runtime_error("Unbalanced parentheses");
+			evaluator.convertInfixToPostfix(infixExpr);
+			writer.addExpression(infixExpr, evaluator.compilePostfixExpression());
+		}
+		catch (const std::runtime_error& error)
+		{
+			cerr << argv[1] << ":" << lineNumber << ": " << error.what() << ": " << infixExpr << endl;
+			++failures;
+		}
+	}
+
+	if (failures > 0)
+	{
+		cerr << failures << " formula(s) failed to compile, no image written." << endl;
+		return 1;
+	}
+
+	try
+	{
+		writer.writeToFile(argv[2]);
+	}
+	catch (const std::runtime_error& error)
+	{
+		cerr << error.what() << endl;
+		return 1;
+	}
+
+	cout << "Compiled formulas from " << argv[1] << " into " << argv[2] << endl;
+	return 0;
+}
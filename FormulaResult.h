@@ -0,0 +1,17 @@
+/** @file FormulaResult.h
+ * Result of evaluating one formula of a batch. Batch evaluators report failures per formula instead of throwing, so one bad formula does not stop the others.
+ */
+
+#ifndef FORMULA_RESULT_
+#define FORMULA_RESULT_
+
+struct FormulaResult
+{
+    /** The result of the evaluation. Only meaningful when valid is true. */
+    double value;
+
+    /** False if evaluating the formula would have thrown "Division by zero". */
+    bool valid;
+};
+
+#endif
@@ -8,9 +8,29 @@
 
 #include "InfixToPostfixEvaluation.h"
 
-InfixToPostfixEvaluation::InfixToPostfixEvaluation() : variableValues{}
+InfixToPostfixEvaluation::InfixToPostfixEvaluation() : InfixToPostfixEvaluation(std::pmr::get_default_resource())
 {} // end default constructor
 
+InfixToPostfixEvaluation::InfixToPostfixEvaluation(std::pmr::memory_resource* resource) : memoryResource(resource),
+    postfixExpQueue(resource), operatorStack(resource), variableValues{},
+    executionBackend(std::make_shared<StackReplayBackend>())
+{} // end resource constructor
+
+InfixToPostfixEvaluation::InfixToPostfixEvaluation(const InfixToPostfixEvaluation& originalEvaluator)
+    : memoryResource(std::pmr::get_default_resource()), postfixExpQueue(originalEvaluator.postfixExpQueue),
+    operatorStack(originalEvaluator.operatorStack), variableValues(originalEvaluator.variableValues),
+    executionBackend(originalEvaluator.executionBackend)
+{} // end copy constructor
+
+InfixToPostfixEvaluation& InfixToPostfixEvaluation::operator=(const InfixToPostfixEvaluation& originalEvaluator)
+{
+    postfixExpQueue = originalEvaluator.postfixExpQueue;
+    operatorStack = originalEvaluator.operatorStack;
+    variableValues = originalEvaluator.variableValues;
+    executionBackend = originalEvaluator.executionBackend;
+    return *this;
+} // end copy assignment
+
 int InfixToPostfixEvaluation::precedence(char operatorChar) const noexcept
 {
     if (operatorChar == '+' || operatorChar == '-')
@@ -24,10 +44,11 @@ int InfixToPostfixEvaluation::precedence(char operatorChar) const noexcept
     return 0;
 } // end precedence
 
-void InfixToPostfixEvaluation::convertInfixToPostfix(const std::string& infixExpression) noexcept
+void InfixToPostfixEvaluation::convertInfixToPostfix(const std::string& infixExpression)
 {
-    postfixExpQueue = LinkedDeque<char>();       // Initialize an empty deque for queue functionality
-    operatorStack = LinkedDeque<char>();         // Initialize an empty deque for stack functionality
+    Tracer::Span span("convertInfixToPostfix");
+    postfixExpQueue.clear();       // Start with an empty deque for queue functionality
+    operatorStack.clear();         // Start with an empty deque for stack functionality
 
     for (char currentChar : infixExpression) // Range-based loop over infix expression
     {
@@ -49,9 +70,7 @@ void InfixToPostfixEvaluation::convertInfixToPostfix(const std::string& infixExp
                 while (!operatorStack.isEmpty() && operatorStack.peekBack() != '(' &&
                     precedence(currentChar) <= precedence(operatorStack.peekBack()))
                 {
-                    char nextOperator = operatorStack.peekBack();
-                    postfixExpQueue.enqueueBack(nextOperator);  // Enqueue operator
-                    operatorStack.dequeueBack();
+                    postfixExpQueue.enqueueBack(operatorStack.popBack());  // Move operator to postfix expression
                 }
                 operatorStack.enqueueBack(currentChar);  // Save the operator on stack
                 break;
@@ -59,9 +78,7 @@ void InfixToPostfixEvaluation::convertInfixToPostfix(const std::string& infixExp
             case ')':  // Closing parenthesis
                 while (operatorStack.peekBack() != '(')
                 {
-                    char nextOperator = operatorStack.peekBack();
-                    postfixExpQueue.enqueueBack(nextOperator);  // Enqueue operator
-                    operatorStack.dequeueBack();
+                    postfixExpQueue.enqueueBack(operatorStack.popBack());  // Move operator to postfix expression
                 }
                 operatorStack.dequeueBack();  // Remove the open parenthesis
                 break;
@@ -72,29 +89,34 @@ void InfixToPostfixEvaluation::convertInfixToPostfix(const std::string& infixExp
     // Add remaining operators to postfix expression
     while (!operatorStack.isEmpty())
     {
-        char nextOperator = operatorStack.peekBack();
-        postfixExpQueue.enqueueBack(nextOperator);  // Enqueue remaining operators
-        operatorStack.dequeueBack();
+        postfixExpQueue.enqueueBack(operatorStack.popBack());  // Enqueue remaining operators
     }
 } // end convertInfixToPostfix
 
 std::string InfixToPostfixEvaluation::getPostfixExpression() const noexcept
 {
-    // Convert the contents of postfixExpQueue to a string for output
-    LinkedDeque<char> tempQueue = postfixExpQueue;  // Copy the deque to avoid modifying the original
+    // Convert the contents of postfixExpQueue to a string for output, walking the deque in place
     std::string postfixExpression;
-
-    while (!tempQueue.isEmpty())
-    {
-        postfixExpression += tempQueue.peekFront();
-        tempQueue.dequeueFront();
-    }
+    postfixExpQueue.forEach([&postfixExpression](char token) { postfixExpression += token; });
 
     return postfixExpression;
 } // end getPostfixExpression
 
+PersistentDeque<char> InfixToPostfixEvaluation::snapshotPostfixExpression() const
+{
+    std::string postfixExpression = getPostfixExpression();
+    return PersistentDeque<char>(postfixExpression.begin(), postfixExpression.end());
+} // end snapshotPostfixExpression
+
+void InfixToPostfixEvaluation::loadPostfixExpression(const std::string& postfixExpression)
+{
+    postfixExpQueue.clear();  // Start with an empty deque for queue functionality
+    postfixExpQueue.enqueueBack(postfixExpression.begin(), postfixExpression.end());
+} // end loadPostfixExpression
+
 void InfixToPostfixEvaluation::readValuesFromFile(const std::string& filename)
 {
+    Tracer::Span span("readValuesFromFile");
     std::ifstream file(filename); // Open the file
     if (!file) // Throw error if the file could not be opened
     {
@@ -110,6 +132,11 @@ void InfixToPostfixEvaluation::readValuesFromFile(const std::string& filename)
     }
 } // end readValuesFromFile
 
+void InfixToPostfixEvaluation::setVariableValues(const std::array<int, CAPACITY>& values) noexcept
+{
+    variableValues = values;
+} // end setVariableValues
+
 void InfixToPostfixEvaluation::clearVariableValues() noexcept
 {
     for (size_t i = 0; i < CAPACITY; ++i) // Set values to zero to clear the array
@@ -120,23 +147,56 @@ void InfixToPostfixEvaluation::clearVariableValues() noexcept
 
 std::string InfixToPostfixEvaluation::getVariableValues() const noexcept
 {
-    std::string result = "Variable values : "; // Declare string to concatenate values
+    // Format every value into one stack buffer, then build the string once
+    static constexpr char prefix[] = "Variable values : ";
+    char formatted[sizeof(prefix) + CAPACITY * 12];
+    char* end = std::copy(prefix, prefix + sizeof(prefix) - 1, formatted);
     for (size_t i = 0; i < CAPACITY; ++i)
     {
-        result += " " + std::to_string(variableValues[i]); // Concatenate all values from the array to the string
+        *end++ = ' ';
+        end = std::to_chars(end, formatted + sizeof(formatted), variableValues[i]).ptr;
     }
-    return result; // Return string of values
+    return std::string(formatted, end); // Return string of values
 } // end getVariableValues
 
+void InfixToPostfixEvaluation::applyOperator(LinkedDeque<double>& evaluationStack, char operatorChar)
+{
+    if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
+
+    // Pop the top two operands
+    double operand2 = evaluationStack.popBack();
+
+    if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
+    double operand1 = evaluationStack.popBack();
+
+    // Perform the operation based on the operator
+    double result = CompiledExpression::applyOperator(operatorChar, operand1, operand2);
+
+    // Push the result back onto the deque
+    evaluationStack.enqueueBack(result);
+} // end applyOperator
+
 double InfixToPostfixEvaluation::evaluatePostfixExpression()
 {
-    LinkedDeque<double> evaluationStack;  // Deque to hold intermediate results
+    Tracer::Span span("evaluatePostfixExpression");
+    bool countOpcodes = Tracer::isEnabled();
+    Tracer::OpcodeHistogram opcodeCounts{};
+
+    LinkedDeque<double> evaluationStack(memoryResource);  // Deque to hold intermediate results
 
     // Loop through each character in the postfix expression deque
     while (!postfixExpQueue.isEmpty())
     {
-        char currentChar = postfixExpQueue.peekFront();
-        postfixExpQueue.dequeueFront();
+        char currentChar = postfixExpQueue.popFront();
+
+        if (countOpcodes)
+        {
+            size_t opcode = Tracer::opcodeIndex(currentChar);
+            if (opcode < Tracer::OPCODE_COUNT)
+            {
+                ++opcodeCounts[opcode];
+            }
+        }
 
         if (std::isalpha(currentChar))  // Operand
         {
@@ -145,45 +205,113 @@ double InfixToPostfixEvaluation::evaluatePostfixExpression()
         }
         else  // Operator
         {
-            if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
+            applyOperator(evaluationStack, currentChar);
+        }
+    }
+
+    if (countOpcodes)
+    {
+        Tracer::recordOpcodes(opcodeCounts);
+    }
+
+    // The final result should be the only element in the deque
+    if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
+
+    double finalResult = evaluationStack.popBack();
+
+    // If the deque is not empty, it means the postfix expression was invalid
+    if (!evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
 
-            // Pop the top two operands
-            double operand2 = evaluationStack.peekBack();
-            evaluationStack.dequeueBack();
+    return finalResult;
+} // end evaluatePostfixExpression
 
-            if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
-            double operand1 = evaluationStack.peekBack();
-            evaluationStack.dequeueBack();
+double InfixToPostfixEvaluation::evaluateInfixExpression(const std::string& infixExpression)
+{
+    Tracer::Span span("evaluateInfixExpression");
+    LinkedDeque<double> evaluationStack(memoryResource);  // Deque to hold operands and intermediate results
+    LinkedDeque<char> pendingOperators(memoryResource);   // Deque to hold operators waiting to be applied
 
-            double result = 0;
+    // Same traversal as convertInfixToPostfix, but operators are applied as they are popped
+    for (char currentChar : infixExpression)
+    {
+        currentChar = std::tolower(currentChar);  // Convert to lowercase if uppercase
 
-            // Perform the operation based on the operator
+        if (std::isalpha(currentChar))
+        {
+            int variableIndex = currentChar - 'a';  // Convert variables to corresponding index
+            evaluationStack.enqueueBack(variableValues[variableIndex]);
+        }
+        else
+        {
             switch (currentChar)
             {
-            case '+': result = operand1 + operand2; break;
-            case '-': result = operand1 - operand2; break;
-            case '*': result = operand1 * operand2; break;
-            case '/':
-                if (operand2 == 0) throw std::runtime_error("Division by zero");
-                result = operand1 / operand2;
+            case '(':  // Opening parenthesis
+                pendingOperators.enqueueBack(currentChar);
+                break;
+
+            case '+': case '-': case '*': case '/':  // Valid operators
+                while (!pendingOperators.isEmpty() && pendingOperators.peekBack() != '(' &&
+                    precedence(currentChar) <= precedence(pendingOperators.peekBack()))
+                {
+                    applyOperator(evaluationStack, pendingOperators.popBack());
+                }
+                pendingOperators.enqueueBack(currentChar);
                 break;
-            default:
-                throw std::runtime_error("Unknown operator encountered");
-            }
 
-            // Push the result back onto the deque
-            evaluationStack.enqueueBack(result);
+            case ')':  // Closing parenthesis
+                while (pendingOperators.peekBack() != '(')
+                {
+                    applyOperator(evaluationStack, pendingOperators.popBack());
+                }
+                pendingOperators.dequeueBack();  // Remove the open parenthesis
+                break;
+            }
         }
     }
 
+    // Apply remaining operators
+    while (!pendingOperators.isEmpty())
+    {
+        applyOperator(evaluationStack, pendingOperators.popBack());
+    }
+
     // The final result should be the only element in the deque
     if (evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
 
-    double finalResult = evaluationStack.peekBack();
-    evaluationStack.dequeueBack();
+    double finalResult = evaluationStack.popBack();
 
-    // If the deque is not empty, it means the postfix expression was invalid
+    // If the deque is not empty, it means the expression was invalid
     if (!evaluationStack.isEmpty()) throw std::runtime_error("Invalid postfix expression");
 
     return finalResult;
-} // end evaluatePostfixExpression
\ No newline at end of file
+} // end evaluateInfixExpression
+
+CompiledExpression InfixToPostfixEvaluation::compilePostfixExpression() const
+{
+    Tracer::Span span("compilePostfixExpression");
+    return CompiledExpression(getPostfixExpression());
+} // end compilePostfixExpression
+
+EvaluationContext InfixToPostfixEvaluation::createEvaluationContext() const
+{
+    return EvaluationContext(variableValues);
+} // end createEvaluationContext
+
+void InfixToPostfixEvaluation::setExecutionBackend(std::shared_ptr<const ExecutionBackendInterface> backend)
+{
+    if (!backend)
+    {
+        throw std::invalid_argument("Execution backend must not be null");
+    }
+    executionBackend = std::move(backend);
+} // end setExecutionBackend
+
+double InfixToPostfixEvaluation::evaluateCompiledExpression(const CompiledExpression& expression) const
+{
+    Tracer::Span span("evaluateCompiledExpression");
+    if (Tracer::isEnabled())
+    {
+        Tracer::recordBytecode(expression.getBytecode());
+    }
+    return executionBackend->execute(expression, variableValues, memoryResource);  // Scratch storage comes from the evaluator's resource
+} // end evaluateCompiledExpression
\ No newline at end of file
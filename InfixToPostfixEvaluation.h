@@ -12,14 +12,26 @@
 #include <fstream>
 #include "InfixToPostfixInterface.h"
 #include "LinkedDeque.h"
+#include "PersistentDeque.h"
+#include "CompiledExpression.h"
+#include "EvaluationContext.h"
+#include "StackReplayBackend.h"
+#include "Tracer.h"
+#include <algorithm>
 #include <array>
+#include <charconv>
+#include <memory>
+#include <memory_resource>
 
 
 class InfixToPostfixEvaluation : public InfixToPostfixInterface
 {
 private:
     /** Capacity of the variable values array */
-    static constexpr size_t CAPACITY = 6;
+    static constexpr size_t CAPACITY = CompiledExpression::VARIABLE_CAPACITY;
+
+    /** Memory resource for the deques used during conversion and evaluation */
+    std::pmr::memory_resource* memoryResource;
 
     /** Deque to store the postfix expression */
     LinkedDeque<char> postfixExpQueue;  // Acts as a queue
@@ -30,6 +42,9 @@ private:
     /** STL Array to store values of variables a-f. All values are initially set to 0 by the default constructor. */
     std::array<int, CAPACITY> variableValues;
 
+    /** Backend used by evaluateCompiledExpression. Defaults to replaying the postfix tokens on a stack. */
+    std::shared_ptr<const ExecutionBackendInterface> executionBackend;
+
     /** Helper function to determine the precedence of an operator.
      * @pre None
      * @post None
@@ -37,18 +52,46 @@ private:
      * @return An integer representing the precedence level. */
     int precedence(char operatorChar) const noexcept;
 
+    /** Helper function to pop the top two operands, apply an operator to them, and push the result.
+     * @pre None
+     * @post The top two operands are replaced by the result of the operation.
+     * @param evaluationStack The deque holding operands and intermediate results.
+     * @param operatorChar The operator character to apply.
+     * @throws std::runtime_error If there are fewer than two operands.
+     * @throws std::runtime_error If an unknown operator is encountered.
+     * @throws std::runtime_error If division by zero occurs. */
+    static void applyOperator(LinkedDeque<double>& evaluationStack, char operatorChar);
+
 public:
+    /** Version of the conversion rules. Increase it whenever convertInfixToPostfix can produce different output, so cached conversions are invalidated. */
+    static constexpr int CONVERTER_VERSION = 1;
+
     /** Default constructor */
     InfixToPostfixEvaluation();
 
+    /** Constructs an evaluator whose postfix queue, operator stack, and evaluation stacks allocate from a memory resource, such as a per-request std::pmr::monotonic_buffer_resource.
+     * @pre resource outlives the evaluator.
+     * @param resource The memory resource to allocate from. */
+    explicit InfixToPostfixEvaluation(std::pmr::memory_resource* resource);
+
+    /** Copy constructor. Like LinkedDeque, the copy allocates from the default memory resource rather than the source's.
+     * @param originalEvaluator The evaluator to copy. */
+    InfixToPostfixEvaluation(const InfixToPostfixEvaluation& originalEvaluator);
+
+    /** Copy assignment. This evaluator keeps allocating from its own memory resource.
+     * @param originalEvaluator The evaluator to copy.
+     * @return A reference to this evaluator. */
+    InfixToPostfixEvaluation& operator=(const InfixToPostfixEvaluation& originalEvaluator);
+
     /** Virtual destructor */
     virtual ~InfixToPostfixEvaluation() = default;
 
     /** Converts an infix expression to a postfix expression.
      * @pre Assumes infix expression is valid.
      * @post Infix expression is converted to postfix. Infix expression is unchanged.
-     * @param infixExpression The infix expression to convert. */
-    void convertInfixToPostfix(const std::string& infixExpression) noexcept override;
+     * @param infixExpression The infix expression to convert.
+     * @throws std::bad_alloc If the memory resource cannot supply a deque node. */
+    void convertInfixToPostfix(const std::string& infixExpression) override;
 
     /** Retrieves the converted postfix expression.
      * @pre None
@@ -56,6 +99,20 @@ public:
      * @return A string representing the postfix expression. */
     std::string getPostfixExpression() const noexcept override;
 
+    /** Takes an immutable snapshot of the converted postfix expression.
+     * Copies of the snapshot share its nodes, and versions derived from it share everything they do not change, so keeping many historical programs costs little memory.
+     * @pre None
+     * @post postfixExpQueue is unchanged.
+     * @return The postfix tokens, front to back. */
+    PersistentDeque<char> snapshotPostfixExpression() const;
+
+    /** Replaces the stored postfix expression with one converted earlier.
+     * @pre postfixExpression was produced by convertInfixToPostfix.
+     * @post postfixExpQueue holds the tokens of postfixExpression.
+     * @param postfixExpression The postfix expression to load.
+     * @throws std::bad_alloc If the memory resource cannot supply a deque node. */
+    void loadPostfixExpression(const std::string& postfixExpression);
+
     /** Reads variable values from a specified file and stores them in the variableValues array.
      * @pre Assumes file exists and contains at least the same number of integer values as CAPACITY.
      * @post variableValues is filled with integer values from the file. File is unchanged.
@@ -64,6 +121,12 @@ public:
      * @throw std::runtime_error If the file does not contain enough values. */
     void readValuesFromFile(const std::string& filename) override;
 
+    /** Replaces every variable value at once.
+     * @pre None
+     * @post variableValues holds the given values.
+     * @param values The values of variables a-f. */
+    void setVariableValues(const std::array<int, CAPACITY>& values) noexcept;
+
     /** Clears the values in the variableValues array by setting all values to 0.
      * @pre None
      * @post Array values are all 0. */
@@ -83,6 +146,46 @@ public:
      * @throws std::runtime_error If an unknown operator is encountered.
      * @throws std::runtime_error If division by zero occurs. */
     double evaluatePostfixExpression() override;
+
+    /** Evaluates an infix expression directly with an operand stack and an operator stack, without building a postfix expression.
+     * @pre Assumes infix expression is valid.
+     * @post postfixExpQueue is unchanged. Infix expression is unchanged.
+     * @param infixExpression The infix expression to evaluate.
+     * @return The same result convertInfixToPostfix followed by evaluatePostfixExpression would return.
+     * @throws std::runtime_error If the expression is invalid.
+     * @throws std::runtime_error If an unknown operator is encountered.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluateInfixExpression(const std::string& infixExpression) override;
+
+    /** Compiles the current postfix expression so it can be evaluated repeatedly by any execution backend.
+     * @pre postfixExpQueue contains a valid postfix expression.
+     * @post postfixExpQueue is unchanged.
+     * @return The compiled expression.
+     * @throws std::runtime_error If the postfix expression is invalid.
+     * @throws std::runtime_error If an unknown operator is encountered. */
+    CompiledExpression compilePostfixExpression() const;
+
+    /** Creates a per-thread context that evaluates compiled expressions with the current variable values.
+     * Compiled expressions are immutable, so several threads can each evaluate the same one through their own context without locking.
+     * @pre None
+     * @post variableValues is unchanged.
+     * @return A context holding a copy of variableValues. */
+    EvaluationContext createEvaluationContext() const;
+
+    /** Selects the backend used by evaluateCompiledExpression.
+     * @pre backend is not null.
+     * @post Later calls to evaluateCompiledExpression use the new backend.
+     * @param backend The execution backend to use.
+     * @throws std::invalid_argument If backend is null. */
+    void setExecutionBackend(std::shared_ptr<const ExecutionBackendInterface> backend);
+
+    /** Evaluates a compiled expression with the current variable values on the selected backend. The backend's scratch storage comes from this evaluator's memory resource.
+     * @pre None
+     * @post The expression and variable values are unchanged.
+     * @param expression The compiled expression to evaluate.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluateCompiledExpression(const CompiledExpression& expression) const;
 };
 
 #include "InfixToPostfixEvaluation.cpp"
@@ -47,6 +47,13 @@ public:
      * @post Does not change the postfix expression.
      * @return The result of the evaluation as a floating point number. */
     virtual double evaluatePostfixExpression() = 0;
+
+    /** Evaluates an infix expression in a single pass based on the current variable values.
+     * @pre Assumes a valid infix expression using operands a-f and operators +,-,*,/.
+     * @post Does not change the stored postfix expression.
+     * @param infixExpression The infix expression to evaluate.
+     * @return The result of the evaluation as a floating point number. */
+    virtual double evaluateInfixExpression(const std::string& infixExpression) = 0;
 };
 
 #endif
\ No newline at end of file
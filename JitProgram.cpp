@@ -0,0 +1,241 @@
+/** @file JitProgram.cpp
+ * JitProgram translates bytecode into x86-64 SSE2 machine code with the operand stack in xmm registers.
+ * @class JitProgram
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "JitProgram.h"
+#include "BytecodeBackend.h"
+#include <cstring>
+
+#ifdef JIT_PROGRAM_NATIVE_SUPPORTED
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+JitProgram::JitProgram(const CompiledExpression& compiledExpression)
+    : expression(compiledExpression), codeMemory(nullptr), codeMemorySize(0)
+{
+#ifdef JIT_PROGRAM_NATIVE_SUPPORTED
+    if (expression.getMaxStackDepth() <= MAX_NATIVE_STACK_DEPTH && __builtin_cpu_supports("sse2"))
+    {
+        installCode(generateCode());
+    }
+#endif
+} // end constructor
+
+JitProgram::~JitProgram()
+{
+#ifdef JIT_PROGRAM_NATIVE_SUPPORTED
+    if (codeMemory != nullptr)
+    {
+        munmap(codeMemory, codeMemorySize);
+    }
+#endif
+} // end destructor
+
+std::vector<std::uint8_t> JitProgram::generateCode() const
+{
+    std::vector<std::uint8_t> code;
+    auto emit = [&code](std::initializer_list<std::uint8_t> bytes) { code.insert(code.end(), bytes); };
+    auto emitRel32 = [&code](size_t target)  // Relative to the end of the 4-byte field
+        {
+            std::int32_t displacement = static_cast<std::int32_t>(static_cast<std::int64_t>(target) - static_cast<std::int64_t>(code.size() + 4));
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                code.push_back(static_cast<std::uint8_t>(static_cast<std::uint32_t>(displacement) >> shift));
+            }
+        };
+    auto patchRel32 = [&code](size_t field, size_t target)
+        {
+            std::int32_t displacement = static_cast<std::int32_t>(static_cast<std::int64_t>(target) - static_cast<std::int64_t>(field + 4));
+            std::memcpy(&code[field], &displacement, sizeof(displacement));
+        };
+
+    // Column pointers of variables a-f live in r8, r9, r10, r11, rdi and rax. rdi holds the column
+    // array itself, so f is loaded first and e last. rsi = results, rdx = rowCount, rcx = row.
+    static const std::uint8_t columnRegisters[CompiledExpression::VARIABLE_CAPACITY] = { 8, 9, 10, 11, 7, 0 };
+    std::uint8_t referenced = expression.getReferencedVariables();
+    const size_t loadOrder[CompiledExpression::VARIABLE_CAPACITY] = { 5, 0, 1, 2, 3, 4 };
+    for (size_t variable : loadOrder)
+    {
+        if ((referenced >> variable) & 1)
+        {
+            std::uint8_t reg = columnRegisters[variable];
+            // mov reg, [rdi + 8 * variable]
+            emit({ static_cast<std::uint8_t>(0x48 | (reg >= 8 ? 0x04 : 0)), 0x8B,
+                static_cast<std::uint8_t>(0x40 | ((reg & 7) << 3) | 7), static_cast<std::uint8_t>(8 * variable) });
+        }
+    }
+
+    emit({ 0x31, 0xC9 });                    // xor ecx, ecx
+    emit({ 0x66, 0x45, 0x0F, 0x57, 0xFF });  // xorpd xmm15, xmm15
+    emit({ 0x48, 0x85, 0xD2 });              // test rdx, rdx
+    emit({ 0x0F, 0x84 });                    // jz done
+    size_t emptyJump = code.size();
+    emitRel32(0);
+
+    size_t loopStart = code.size();
+    std::vector<size_t> divideByZeroJumps;
+    size_t depth = 0;
+    for (std::uint8_t instruction : expression.getBytecode())
+    {
+        auto opcode = static_cast<CompiledExpression::Opcode>(instruction);
+        if (opcode < CompiledExpression::Opcode::Add)
+        {
+            // xorps xmm[depth], xmm[depth] first: cvtsi2sd keeps the upper half of its destination,
+            // which would otherwise chain every row to the previous row's result
+            if (depth >= 8)
+            {
+                code.push_back(0x45);
+            }
+            emit({ 0x0F, 0x57, static_cast<std::uint8_t>(0xC0 | ((depth & 7) << 3) | (depth & 7)) });
+
+            // cvtsi2sd xmm[depth], dword [column + rcx * 4]
+            std::uint8_t reg = columnRegisters[instruction];
+            std::uint8_t rex = static_cast<std::uint8_t>(0x40 | (depth >= 8 ? 0x04 : 0) | (reg >= 8 ? 0x01 : 0));
+            code.push_back(0xF2);
+            if (rex != 0x40)
+            {
+                code.push_back(rex);
+            }
+            emit({ 0x0F, 0x2A, static_cast<std::uint8_t>(((depth & 7) << 3) | 4), static_cast<std::uint8_t>(0x88 | (reg & 7)) });
+            ++depth;
+            continue;
+        }
+
+        size_t left = depth - 2;
+        size_t right = depth - 1;
+        if (opcode == CompiledExpression::Opcode::Divide)
+        {
+            // ucomisd xmm[right], xmm15; a NaN divisor sets PF and is not zero
+            emit({ 0x66, static_cast<std::uint8_t>(0x41 | (right >= 8 ? 0x04 : 0)), 0x0F, 0x2E,
+                static_cast<std::uint8_t>(0xC0 | ((right & 7) << 3) | 7) });
+            emit({ 0x7A, 0x06 });  // jp over the je
+            emit({ 0x0F, 0x84 });  // je divideByZero
+            divideByZeroJumps.push_back(code.size());
+            emitRel32(0);
+        }
+
+        std::uint8_t operation = 0x58;
+        switch (opcode)
+        {
+        case CompiledExpression::Opcode::Add: operation = 0x58; break;
+        case CompiledExpression::Opcode::Subtract: operation = 0x5C; break;
+        case CompiledExpression::Opcode::Multiply: operation = 0x59; break;
+        default: operation = 0x5E; break;
+        }
+
+        // op xmm[left], xmm[right]
+        std::uint8_t rex = static_cast<std::uint8_t>(0x40 | (left >= 8 ? 0x04 : 0) | (right >= 8 ? 0x01 : 0));
+        code.push_back(0xF2);
+        if (rex != 0x40)
+        {
+            code.push_back(rex);
+        }
+        emit({ 0x0F, operation, static_cast<std::uint8_t>(0xC0 | ((left & 7) << 3) | (right & 7)) });
+        --depth;
+    }
+
+    emit({ 0xF2, 0x0F, 0x11, 0x04, 0xCE });  // movsd [rsi + rcx * 8], xmm0
+    emit({ 0x48, 0xFF, 0xC1 });              // inc rcx
+    emit({ 0x48, 0x39, 0xD1 });              // cmp rcx, rdx
+    emit({ 0x0F, 0x82 });                    // jb loopStart
+    emitRel32(loopStart);
+
+    // done and divideByZero both return the number of completed rows
+    size_t exitLabel = code.size();
+    emit({ 0x48, 0x89, 0xC8 });  // mov rax, rcx
+    emit({ 0xC3 });              // ret
+
+    patchRel32(emptyJump, exitLabel);
+    for (size_t jump : divideByZeroJumps)
+    {
+        patchRel32(jump, exitLabel);
+    }
+    return code;
+} // end generateCode
+
+void JitProgram::installCode(const std::vector<std::uint8_t>& code) noexcept
+{
+#ifdef JIT_PROGRAM_NATIVE_SUPPORTED
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t mappingSize = (code.size() + pageSize - 1) / pageSize * pageSize;
+
+    // Never writable and executable at the same time
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+    std::memcpy(mapping, code.data(), code.size());
+    if (mprotect(mapping, mappingSize, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(mapping, mappingSize);
+        return;
+    }
+
+    codeMemory = mapping;
+    codeMemorySize = mappingSize;
+#else
+    (void)code;
+#endif
+} // end installCode
+
+void JitProgram::evaluateColumns(const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY], double* results, size_t rowCount) const
+{
+    if (evaluateColumnsUntilFailure(columns, results, rowCount) != rowCount)
+    {
+        throw std::runtime_error("Division by zero");
+    }
+} // end evaluateColumns
+
+size_t JitProgram::evaluateColumnsUntilFailure(const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY], double* results, size_t rowCount) const
+{
+    if (codeMemory != nullptr)
+    {
+        NativeFunction function = reinterpret_cast<NativeFunction>(codeMemory);
+        return function(columns, results, rowCount);
+    }
+
+    // Interpreter fallback, one row at a time
+    const std::vector<std::uint8_t>& bytecode = expression.getBytecode();
+    std::uint8_t referenced = expression.getReferencedVariables();
+    CompiledExpression::VariableArray row{};
+    for (size_t r = 0; r < rowCount; ++r)
+    {
+        for (size_t v = 0; v < CompiledExpression::VARIABLE_CAPACITY; ++v)
+        {
+            row[v] = (referenced >> v) & 1 ? columns[v][r] : 0;
+        }
+        try
+        {
+            results[r] = BytecodeBackend::run(bytecode.data(), bytecode.size(), expression.getMaxStackDepth(), row);
+        }
+        catch (const std::runtime_error&)
+        {
+            return r;  // Division by zero is the only error a compiled expression can raise
+        }
+    }
+    return rowCount;
+} // end evaluateColumnsUntilFailure
+
+double JitProgram::evaluate(const CompiledExpression::VariableArray& variableValues) const
+{
+    const std::int32_t* columns[CompiledExpression::VARIABLE_CAPACITY];
+    for (size_t v = 0; v < CompiledExpression::VARIABLE_CAPACITY; ++v)
+    {
+        columns[v] = &variableValues[v];  // A one-row column per variable
+    }
+
+    double result = 0;
+    evaluateColumns(columns, &result, 1);
+    return result;
+} // end evaluate
+
+bool JitProgram::isNative() const noexcept
+{
+    return codeMemory != nullptr;
+} // end isNative
@@ -0,0 +1,98 @@
+/** @file JitProgram.h
+ * @class JitProgram
+ * Native x86-64 form of a compiled expression for Linux. The bytecode is translated into SSE2 machine code in its own mmap'd page, with operand stack slot k kept in register xmmk, wrapped in a loop over rows of columnar int32 variable input. Code is written while the page is writable and then made read-only and executable. Expressions deeper than the 15 usable registers, other platforms, CPUs without SSE2 and systems that refuse executable memory all fall back to the bytecode interpreter, with identical results.
+ */
+
+#ifndef JIT_PROGRAM_
+#define JIT_PROGRAM_
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "CompiledExpression.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#define JIT_PROGRAM_NATIVE_SUPPORTED 1
+#endif
+
+class JitProgram
+{
+public:
+    /** Signature of the generated code: columns[v][row] is variable v of a row, results[row] receives the result.
+     * Returns the number of rows completed, which is less than rowCount if a row divided by zero. */
+    using NativeFunction = size_t (*)(const std::int32_t* const* columns, double* results, size_t rowCount);
+
+    /** Number of operand stack slots kept in registers. xmm15 holds the zero divisors are compared with. */
+    static constexpr size_t MAX_NATIVE_STACK_DEPTH = 15;
+
+private:
+    /** The expression, kept for the interpreter fallback. */
+    CompiledExpression expression;
+
+    /** Executable code, or nullptr when falling back to the interpreter. */
+    void* codeMemory;
+
+    /** Size of the mapping holding the code. */
+    size_t codeMemorySize;
+
+    /** Helper function to translate the bytecode into machine code.
+     * @pre maxStackDepth <= MAX_NATIVE_STACK_DEPTH
+     * @post None
+     * @return The machine code of the row loop. */
+    std::vector<std::uint8_t> generateCode() const;
+
+    /** Helper function to copy machine code into executable memory.
+     * @pre None
+     * @post codeMemory holds the code if the system allowed it, otherwise it stays nullptr.
+     * @param code The machine code. */
+    void installCode(const std::vector<std::uint8_t>& code) noexcept;
+
+public:
+    /** Compiles an expression to native code when the platform and expression allow it.
+     * @pre None
+     * @post The program computes the same results as evaluatePostfixExpression.
+     * @param compiledExpression The compiled expression to translate. */
+    explicit JitProgram(const CompiledExpression& compiledExpression);
+
+    /** Programs own their executable memory and cannot be copied. */
+    JitProgram(const JitProgram&) = delete;
+
+    /** Programs own their executable memory and cannot be copied. */
+    JitProgram& operator=(const JitProgram&) = delete;
+
+    /** Releases the executable memory. */
+    ~JitProgram();
+
+    /** Evaluates the program for every row of columnar variable input.
+     * @pre columns[v] points to rowCount values of variable v for every variable the expression references. results has room for rowCount values.
+     * @post results holds the result of every row before the first row that divided by zero.
+     * @param columns One pointer per variable a-f.
+     * @param results Receives one result per row.
+     * @param rowCount The number of rows.
+     * @throws std::runtime_error If division by zero occurs in any row. */
+    void evaluateColumns(const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY], double* results, size_t rowCount) const;
+
+    /** Evaluates rows of columnar variable input up to the first row that divides by zero, without throwing.
+     * @pre columns[v] points to rowCount values of variable v for every variable the expression references. results has room for rowCount values.
+     * @post results holds the result of every row before the first row that divided by zero.
+     * @param columns One pointer per variable a-f.
+     * @param results Receives one result per row.
+     * @param rowCount The number of rows.
+     * @return The number of rows evaluated, which is rowCount unless a row divided by zero. That row is the one at the returned index. */
+    size_t evaluateColumnsUntilFailure(const std::int32_t* const columns[CompiledExpression::VARIABLE_CAPACITY], double* results, size_t rowCount) const;
+
+    /** Evaluates the program for one row.
+     * @pre None
+     * @post The program is unchanged.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression::VariableArray& variableValues) const;
+
+    /** Sees whether the program runs as native code.
+     * @return True for native code, false if it falls back to the interpreter. */
+    bool isNative() const noexcept;
+};
+
+#include "JitProgram.cpp"
+#endif
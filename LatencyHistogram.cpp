@@ -0,0 +1,126 @@
+/** @file LatencyHistogram.cpp
+ * LatencyHistogram counts latencies in log-linear buckets and reports percentiles.
+ * @class LatencyHistogram
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram()
+    : bucketCounts(bucketIndex(MAX_VALUE) + 1, 0), totalCount(0), minValue(0), maxValue(0), valueSum(0)
+{ } // end constructor
+
+size_t LatencyHistogram::bucketIndex(std::uint64_t value) noexcept
+{
+    if (value < LINEAR_LIMIT)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    // Keep the top SUB_BUCKET_BITS + 1 bits: shift is at least 1 here
+    int shift = std::bit_width(value) - 1 - SUB_BUCKET_BITS;
+    std::uint64_t subBucket = (value >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<size_t>(LINEAR_LIMIT + (shift - 1) * SUB_BUCKET_COUNT + subBucket);
+} // end bucketIndex
+
+std::uint64_t LatencyHistogram::bucketUpperBound(size_t index) noexcept
+{
+    if (index < LINEAR_LIMIT)
+    {
+        return index;
+    }
+
+    std::uint64_t offset = index - LINEAR_LIMIT;
+    int shift = static_cast<int>(offset / SUB_BUCKET_COUNT) + 1;
+    std::uint64_t subBucket = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((subBucket + 1) << shift) - 1;
+} // end bucketUpperBound
+
+void LatencyHistogram::record(std::uint64_t nanoseconds) noexcept
+{
+    nanoseconds = std::min(nanoseconds, MAX_VALUE);
+    ++bucketCounts[bucketIndex(nanoseconds)];
+
+    if (totalCount == 0 || nanoseconds < minValue)
+    {
+        minValue = nanoseconds;
+    }
+    maxValue = std::max(maxValue, nanoseconds);
+    valueSum += nanoseconds;
+    ++totalCount;
+} // end record
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept
+{
+    if (other.totalCount == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < bucketCounts.size(); ++i)
+    {
+        bucketCounts[i] += other.bucketCounts[i];
+    }
+    minValue = totalCount == 0 ? other.minValue : std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+    valueSum += other.valueSum;
+    totalCount += other.totalCount;
+} // end merge
+
+void LatencyHistogram::reset() noexcept
+{
+    std::fill(bucketCounts.begin(), bucketCounts.end(), 0);
+    totalCount = 0;
+    minValue = 0;
+    maxValue = 0;
+    valueSum = 0;
+} // end reset
+
+std::uint64_t LatencyHistogram::getValueAtPercentile(double percentile) const noexcept
+{
+    if (totalCount == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the requested value, counting from 1
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(percentile / 100 * totalCount));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < bucketCounts.size(); ++i)
+    {
+        seen += bucketCounts[i];
+        if (seen >= rank)
+        {
+            return std::min(bucketUpperBound(i), maxValue);
+        }
+    }
+    return maxValue;
+} // end getValueAtPercentile
+
+std::uint64_t LatencyHistogram::getCount() const noexcept
+{
+    return totalCount;
+} // end getCount
+
+std::uint64_t LatencyHistogram::getMin() const noexcept
+{
+    return minValue;
+} // end getMin
+
+std::uint64_t LatencyHistogram::getMax() const noexcept
+{
+    return maxValue;
+} // end getMax
+
+double LatencyHistogram::getMean() const noexcept
+{
+    return totalCount == 0 ? 0 : static_cast<double>(valueSum / totalCount);
+} // end getMean
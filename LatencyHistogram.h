@@ -0,0 +1,102 @@
+/** @file LatencyHistogram.h
+ * @class LatencyHistogram
+ * Records latencies in nanoseconds into HDR-style log-linear buckets: exact below 256 ns, then 128 buckets per power of two, so every recorded value is kept to within 1% with a fixed, small amount of memory. Recording is a few shifts and an increment. Histograms from separate threads are merged afterwards, so recording needs no synchronization.
+ */
+
+#ifndef LATENCY_HISTOGRAM_
+#define LATENCY_HISTOGRAM_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class LatencyHistogram
+{
+public:
+    /** Bits of precision kept within each power of two. */
+    static constexpr int SUB_BUCKET_BITS = 7;
+
+    /** Largest recordable value. Larger values are clamped to it. */
+    static constexpr std::uint64_t MAX_VALUE = (std::uint64_t(1) << 40) - 1;
+
+private:
+    /** Number of buckets per power of two. */
+    static constexpr std::uint64_t SUB_BUCKET_COUNT = std::uint64_t(1) << SUB_BUCKET_BITS;
+
+    /** Values below this are counted exactly. */
+    static constexpr std::uint64_t LINEAR_LIMIT = SUB_BUCKET_COUNT * 2;
+
+    /** Count of values per bucket. */
+    std::vector<std::uint64_t> bucketCounts;
+
+    /** Number of recorded values. */
+    std::uint64_t totalCount;
+
+    /** Smallest recorded value. */
+    std::uint64_t minValue;
+
+    /** Largest recorded value. */
+    std::uint64_t maxValue;
+
+    /** Sum of recorded values, for the mean. */
+    long double valueSum;
+
+    /** Helper function to find the bucket of a value.
+     * @pre value <= MAX_VALUE
+     * @return The bucket index. */
+    static size_t bucketIndex(std::uint64_t value) noexcept;
+
+    /** Helper function to find the largest value that falls in a bucket.
+     * @pre index is a valid bucket index.
+     * @return The upper bound of the bucket. */
+    static std::uint64_t bucketUpperBound(size_t index) noexcept;
+
+public:
+    /** Creates an empty histogram.
+     * @pre None
+     * @post No values are recorded. */
+    LatencyHistogram();
+
+    /** Records one latency.
+     * @pre None
+     * @post The value, clamped to MAX_VALUE, is counted.
+     * @param nanoseconds The latency to record. */
+    void record(std::uint64_t nanoseconds) noexcept;
+
+    /** Adds every value recorded in another histogram.
+     * @pre None
+     * @post This histogram counts the values of both. The other histogram is unchanged.
+     * @param other The histogram to merge. */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /** Removes every recorded value.
+     * @pre None
+     * @post No values are recorded. */
+    void reset() noexcept;
+
+    /** Retrieves the value below which a given percentage of recorded values fall.
+     * @pre None
+     * @post None
+     * @param percentile The percentage, from 0 to 100.
+     * @return The upper bound of the bucket holding that value, never more than the largest recorded value, or 0 if nothing is recorded. */
+    std::uint64_t getValueAtPercentile(double percentile) const noexcept;
+
+    /** Retrieves the number of recorded values.
+     * @return The count. */
+    std::uint64_t getCount() const noexcept;
+
+    /** Retrieves the smallest recorded value.
+     * @return The minimum, or 0 if nothing is recorded. */
+    std::uint64_t getMin() const noexcept;
+
+    /** Retrieves the largest recorded value.
+     * @return The maximum, or 0 if nothing is recorded. */
+    std::uint64_t getMax() const noexcept;
+
+    /** Retrieves the mean of the recorded values.
+     * @return The mean, or 0 if nothing is recorded. */
+    double getMean() const noexcept;
+};
+
+#include "LatencyHistogram.cpp"
+#endif
@@ -10,18 +10,54 @@
 #include "PrecondViolatedExcept.h"
 
 template<class ItemType>
-LinkedDeque<ItemType>::LinkedDeque() : frontPtr(nullptr), itemCount(0)
+LinkedDeque<ItemType>::LinkedDeque() : frontPtr(nullptr), itemCount(0), memoryResource(std::pmr::get_default_resource())
 { } // end default constructor
 
 template<class ItemType>
-LinkedDeque<ItemType>::LinkedDeque(const LinkedDeque<ItemType>& originalDeque) : frontPtr(nullptr), itemCount(0)
+LinkedDeque<ItemType>::LinkedDeque(std::pmr::memory_resource* resource) : frontPtr(nullptr), itemCount(0), memoryResource(resource)
+{ } // end resource constructor
+
+template<class ItemType>
+LinkedDeque<ItemType>::LinkedDeque(const LinkedDeque<ItemType>& originalDeque) : frontPtr(nullptr), itemCount(0),
+    memoryResource(std::pmr::get_default_resource())
+{
+    copyFrom(originalDeque);
+} // end copy constructor
+
+template<class ItemType>
+LinkedDeque<ItemType>::LinkedDeque(const LinkedDeque<ItemType>& originalDeque, std::pmr::memory_resource* resource) : frontPtr(nullptr), itemCount(0),
+    memoryResource(resource)
+{
+    copyFrom(originalDeque);
+} // end allocator-extended copy constructor
+
+template<class ItemType>
+LinkedDeque<ItemType>& LinkedDeque<ItemType>::operator=(const LinkedDeque<ItemType>& originalDeque)
+{
+    if (this != &originalDeque)
+    {
+        clear();
+        copyFrom(originalDeque);  // Nodes stay in this deque's own memory resource
+    }
+    return *this;
+} // end copy assignment
+
+template<class ItemType>
+std::shared_ptr<Node<ItemType>> LinkedDeque<ItemType>::makeNode(const ItemType& newEntry) const
+{
+    // The node and its shared_ptr control block are allocated together from the memory resource
+    return std::allocate_shared<Node<ItemType>>(std::pmr::polymorphic_allocator<Node<ItemType>>(memoryResource), newEntry);
+} // end makeNode
+
+template<class ItemType>
+void LinkedDeque<ItemType>::copyFrom(const LinkedDeque<ItemType>& originalDeque)
 {
     auto origChainPtr = originalDeque.frontPtr;  // Points to nodes in the original deque
 
     if (origChainPtr != nullptr)
     {
         // Copy the first node
-        frontPtr = std::make_shared<Node<ItemType>>(origChainPtr->getItem());
+        frontPtr = makeNode(origChainPtr->getItem());
         itemCount++;
 
         // Set up pointers for the circular doubly linked structure
@@ -31,29 +67,40 @@ LinkedDeque<ItemType>::LinkedDeque(const LinkedDeque<ItemType>& originalDeque) :
         origChainPtr = origChainPtr->getNext();
 
         // Copy remaining nodes
-        while (origChainPtr != originalDeque.frontPtr)
+        try
         {
-            // Copy the next item from the original deque
-            ItemType nextItem = origChainPtr->getItem();
-            auto newNode = std::make_shared<Node<ItemType>>(nextItem);
+            while (origChainPtr != originalDeque.frontPtr)
+            {
+                // Copy the next item from the original deque
+                ItemType nextItem = origChainPtr->getItem();
+                auto newNode = makeNode(nextItem);
 
-            // Link the new node to the current chain
-            newNode->setPrevious(endChainPtr);
-            endChainPtr->setNext(newNode);
+                // Link the new node to the current chain
+                newNode->setPrevious(endChainPtr);
+                endChainPtr->setNext(newNode);
 
-            // Move the end pointer to the new node
-            endChainPtr = newNode;
-            itemCount++;
+                // Move the end pointer to the new node
+                endChainPtr = newNode;
+                itemCount++;
 
-            // Move to the next node in the original deque
-            origChainPtr = origChainPtr->getNext();
+                // Move to the next node in the original deque
+                origChainPtr = origChainPtr->getNext();
+            }
+        }
+        catch (...)
+        {
+            // Close the partial copy so clear can release it
+            endChainPtr->setNext(frontPtr);
+            frontPtr->setPrevious(endChainPtr);
+            clear();
+            throw;
         }
 
         // Complete the circular linking
         endChainPtr->setNext(frontPtr);
         frontPtr->setPrevious(endChainPtr);
     }
-} // end copy constructor
+} // end copyFrom
 
 template<class ItemType>
 LinkedDeque<ItemType>::~LinkedDeque()
@@ -68,9 +115,9 @@ bool LinkedDeque<ItemType>::isEmpty() const noexcept
 } // end isEmpty
 
 template<class ItemType>
-bool LinkedDeque<ItemType>::enqueueFront(const ItemType& newEntry) noexcept
+bool LinkedDeque<ItemType>::enqueueFront(const ItemType& newEntry)
 {
-    auto newNode = std::make_shared<Node<ItemType>>(newEntry);
+    auto newNode = makeNode(newEntry);
     if (isEmpty())
     {
         // First node points to itself in a circular structure
@@ -92,9 +139,9 @@ bool LinkedDeque<ItemType>::enqueueFront(const ItemType& newEntry) noexcept
 } // end enqueueFront
 
 template<class ItemType>
-bool LinkedDeque<ItemType>::enqueueBack(const ItemType& newEntry) noexcept
+bool LinkedDeque<ItemType>::enqueueBack(const ItemType& newEntry)
 {
-    auto newNode = std::make_shared<Node<ItemType>>(newEntry);
+    auto newNode = makeNode(newEntry);
     if (isEmpty())
     {
         // First node points to itself in a circular structure
@@ -123,6 +170,7 @@ bool LinkedDeque<ItemType>::dequeueFront()
     }
     else if (itemCount == 1)
     {
+        frontPtr->setNext(nullptr); // Break the node's link to itself so it is released
         frontPtr.reset(); // Only one node, clear it
     }
     else
@@ -145,7 +193,8 @@ bool LinkedDeque<ItemType>::dequeueBack()
     }
     else if (itemCount == 1)
     {
-        // Only one node, clear it
+        // Only one node, break its link to itself and clear it
+        frontPtr->setNext(nullptr);
         frontPtr.reset();
     }
     else
@@ -161,6 +210,152 @@ bool LinkedDeque<ItemType>::dequeueBack()
     return true;
 } // end dequeueBack
 
+template<class ItemType>
+ItemType LinkedDeque<ItemType>::popFront()
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to remove from the front of an empty deque.");
+    }
+
+    ItemType frontItem = frontPtr->takeItem();
+    if (itemCount == 1)
+    {
+        frontPtr->setNext(nullptr); // Break the node's link to itself so it is released
+        frontPtr.reset();
+    }
+    else
+    {
+        auto backPtr = frontPtr->getPrevious();
+        frontPtr = frontPtr->getNext();
+        frontPtr->setPrevious(backPtr);
+        backPtr->setNext(frontPtr);
+    }
+    itemCount--;
+    return frontItem;
+} // end popFront
+
+template<class ItemType>
+ItemType LinkedDeque<ItemType>::popBack()
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to remove from the back of an empty deque.");
+    }
+
+    auto backPtr = frontPtr->getPrevious();  // The only weak_ptr lock needed to reach the back
+    ItemType backItem = backPtr->takeItem();
+    if (itemCount == 1)
+    {
+        frontPtr->setNext(nullptr); // Break the node's link to itself so it is released
+        frontPtr.reset();
+    }
+    else
+    {
+        auto newBackPtr = backPtr->getPrevious();
+        newBackPtr->setNext(frontPtr);
+        frontPtr->setPrevious(newBackPtr);
+    }
+    itemCount--;
+    return backItem;
+} // end popBack
+
+template<class ItemType>
+template<class InputIterator>
+void LinkedDeque<ItemType>::enqueueBack(InputIterator first, InputIterator last)
+{
+    if (first == last)
+    {
+        return;
+    }
+    if (isEmpty())
+    {
+        enqueueBack(*first);
+        ++first;
+    }
+
+    // Append to an open chain and close the circle once at the end, or at the failed allocation
+    auto backPtr = frontPtr->getPrevious();
+    try
+    {
+        for (; first != last; ++first)
+        {
+            auto newNode = makeNode(*first);
+            newNode->setPrevious(backPtr);
+            backPtr->setNext(newNode);
+            backPtr = newNode;
+            itemCount++;
+        }
+    }
+    catch (...)
+    {
+        backPtr->setNext(frontPtr);
+        frontPtr->setPrevious(backPtr);
+        throw;
+    }
+    backPtr->setNext(frontPtr);
+    frontPtr->setPrevious(backPtr);
+} // end enqueueBack
+
+template<class ItemType>
+template<class OutputIterator>
+OutputIterator LinkedDeque<ItemType>::popBack(size_t count, OutputIterator out)
+{
+    if (count > static_cast<size_t>(itemCount))
+    {
+        throw PrecondViolatedExcept("Attempted to remove more items than the deque holds.");
+    }
+    if (count == 0)
+    {
+        return out;
+    }
+
+    // Walk toward the front once, moving each item out
+    auto backPtr = frontPtr->getPrevious();
+    auto currentPtr = backPtr;
+    for (size_t i = 0; i < count; ++i)
+    {
+        *out++ = currentPtr->takeItem();
+        if (i + 1 < count)
+        {
+            currentPtr = currentPtr->getPrevious();
+        }
+    }
+
+    if (count == static_cast<size_t>(itemCount))
+    {
+        clear();
+        return out;
+    }
+
+    // Detach the removed run, then release it one node at a time so a long run does not recurse
+    auto newBackPtr = currentPtr->getPrevious();
+    backPtr->setNext(nullptr);
+    auto removedPtr = newBackPtr->getNext();
+    newBackPtr->setNext(frontPtr);
+    frontPtr->setPrevious(newBackPtr);
+    while (removedPtr != nullptr)
+    {
+        auto nextPtr = removedPtr->getNext();
+        removedPtr->setNext(nullptr);
+        removedPtr = nextPtr;
+    }
+    itemCount -= static_cast<int>(count);
+    return out;
+} // end popBack
+
+template<class ItemType>
+template<class Function>
+void LinkedDeque<ItemType>::forEach(Function visit) const
+{
+    auto currentPtr = frontPtr;
+    for (int i = 0; i < itemCount; ++i)
+    {
+        visit(currentPtr->getItem());
+        currentPtr = currentPtr->getNext();
+    }
+} // end forEach
+
 template<class ItemType>
 ItemType LinkedDeque<ItemType>::peekFront() const
 {
@@ -185,6 +380,24 @@ ItemType LinkedDeque<ItemType>::peekBack() const
 template<class ItemType>
 void LinkedDeque<ItemType>::clear() noexcept
 {
-    frontPtr.reset(); // Clear all nodes by releasing front pointer
+    if (frontPtr != nullptr)
+    {
+        // Break the circular link so the back node no longer keeps the chain alive
+        frontPtr->getPrevious()->setNext(nullptr);
+
+        // Release nodes one at a time so destroying a long chain does not recurse
+        while (frontPtr != nullptr)
+        {
+            auto nextPtr = frontPtr->getNext();
+            frontPtr->setNext(nullptr);
+            frontPtr = nextPtr;
+        }
+    }
     itemCount = 0;
-} // end clear
\ No newline at end of file
+} // end clear
+
+template<class ItemType>
+std::pmr::memory_resource* LinkedDeque<ItemType>::getMemoryResource() const noexcept
+{
+    return memoryResource;
+} // end getMemoryResource
\ No newline at end of file
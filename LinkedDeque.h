@@ -1,6 +1,7 @@
 /** @file LinkedDeque.h
  * @class LinkedDeque
  * Implements a deque. Provides functionality for adding, removing, and peeking at items from both the front and back. This implementation uses a circular doubly linked structure with a single pointer to the front.
+ * Nodes are allocated from a std::pmr::memory_resource, so a deque can draw from a per-request arena and release everything at once.
  */
 
 #ifndef LINKED_DEQUE_
@@ -9,6 +10,7 @@
 #include "DequeInterface.h"
 #include "Node.h"
 #include <memory>
+#include <memory_resource>
 
 template<class ItemType>
 class LinkedDeque : public DequeInterface<ItemType>
@@ -20,18 +22,57 @@ private:
     /** Number of items currently in the deque. */
     int itemCount;
 
+    /** Memory resource that nodes are allocated from. */
+    std::pmr::memory_resource* memoryResource;
+
+    /** Helper function to allocate a node from the memory resource.
+     * @pre None
+     * @post None
+     * @param newEntry The item to store in the node.
+     * @return A shared pointer to the new, unlinked node. */
+    std::shared_ptr<Node<ItemType>> makeNode(const ItemType& newEntry) const;
+
+    /** Helper function to deep copy the nodes of another deque onto the back of this empty deque.
+     * @pre This deque is empty.
+     * @post This deque holds copies of every item of the other deque, in the same order.
+     * @param originalDeque The LinkedDeque object to copy. */
+    void copyFrom(const LinkedDeque<ItemType>& originalDeque);
+
 public:
     /** Default constructor initializes an empty deque.
      * @pre None
-     * @post The deque is empty with frontPtr set to nullptr and itemCount set to 0. */
+     * @post The deque is empty with frontPtr set to nullptr and itemCount set to 0. Nodes come from the default memory resource. */
     LinkedDeque();
 
+    /** Constructs an empty deque that allocates its nodes from a memory resource.
+     * @pre resource outlives the deque.
+     * @post The deque is empty with frontPtr set to nullptr and itemCount set to 0.
+     * @param resource The memory resource to allocate nodes from. */
+    explicit LinkedDeque(std::pmr::memory_resource* resource);
+
     /** Copy constructor creates a deep copy of another LinkedDeque.
+     * Like std::pmr containers, the copy does not inherit the source's memory resource, which may be a short-lived arena.
      * @pre None
-     * @post A new deque is created, with all nodes copied from the source deque.
-     * @param otherDeque The LinkedDeque object to copy. */
+     * @post A new deque is created, with all nodes copied from the source deque into the default memory resource.
+     * @param originalDeque The LinkedDeque object to copy.
+     * @throw std::bad_alloc if the memory resource cannot supply a node. */
     LinkedDeque(const LinkedDeque<ItemType>& originalDeque);
 
+    /** Allocator-extended copy constructor creates a deep copy of another LinkedDeque in a given memory resource.
+     * @pre resource outlives the deque.
+     * @post A new deque is created, with all nodes copied from the source deque into resource.
+     * @param originalDeque The LinkedDeque object to copy.
+     * @param resource The memory resource to allocate nodes from.
+     * @throw std::bad_alloc if the memory resource cannot supply a node. */
+    LinkedDeque(const LinkedDeque<ItemType>& originalDeque, std::pmr::memory_resource* resource);
+
+    /** Copy assignment replaces the contents of this deque with a deep copy of another LinkedDeque.
+     * @pre None
+     * @post This deque holds copies of every item of the other deque, allocated from this deque's memory resource.
+     * @param originalDeque The LinkedDeque object to copy.
+     * @return A reference to this deque. */
+    LinkedDeque<ItemType>& operator=(const LinkedDeque<ItemType>& originalDeque);
+
     /** Destructor clears the deque and frees memory.
      * @pre None
      * @post All nodes in the deque are released, and itemCount is set to 0. */
@@ -47,15 +88,17 @@ public:
      * @pre None
      * @post If the deque was empty, the new node points to itself. Otherwise, the new node is inserted before the current front node, and the circular links are updated.
      * @param newEntry The item to be added as a new entry at the front.
-     * @return True if the addition is successful. */
-    bool enqueueFront(const ItemType& newEntry) noexcept override;
+     * @return True if the addition is successful.
+     * @throw std::bad_alloc if the memory resource cannot supply a node. */
+    bool enqueueFront(const ItemType& newEntry) override;
 
     /** Adds a new entry to the back of the deque.
      * @pre None
      * @post If the deque was empty, the new node points to itself. Otherwise, the new node is inserted after the current back node, and the circular links are updated.
      * @param newEntry The item to be added as a new entry at the back.
-     * @return True if the addition is successful. */
-    bool enqueueBack(const ItemType& newEntry) noexcept override;
+     * @return True if the addition is successful.
+     * @throw std::bad_alloc if the memory resource cannot supply a node. */
+    bool enqueueBack(const ItemType& newEntry) override;
 
     /** Removes the front of the deque.
      * @pre The deque is not empty.
@@ -71,6 +114,46 @@ public:
      * @throw PrecondViolatedExcept if the deque is empty. */
     bool dequeueBack() override;
 
+    /** Removes the front of the deque and returns it, visiting the front node once.
+     * @pre The deque is not empty.
+     * @post The front node is removed, and the circular links are updated.
+     * @return The former front item, moved out of its node.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    ItemType popFront() override;
+
+    /** Removes the back of the deque and returns it, visiting the back node once.
+     * @pre The deque is not empty.
+     * @post The back node is removed, and the circular links are updated.
+     * @return The former back item, moved out of its node.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    ItemType popBack() override;
+
+    /** Adds every item of a range to the back of the deque, in order, linking the circle once at the end.
+     * @pre None
+     * @post The items of the range follow the previous back of the deque.
+     * @param first Iterator to the first item to add.
+     * @param last Iterator past the last item to add.
+     * @throw std::bad_alloc if the memory resource cannot supply a node. The items added before the failure stay linked at the back. */
+    template<class InputIterator>
+    void enqueueBack(InputIterator first, InputIterator last);
+
+    /** Removes count items from the back of the deque, writing them back item first.
+     * @pre The deque holds at least count items.
+     * @post count nodes are removed from the back, and the circular links are updated.
+     * @param count The number of items to remove.
+     * @param out Iterator receiving the removed items, moved out of their nodes.
+     * @return The iterator past the last item written.
+     * @throw PrecondViolatedExcept if the deque holds fewer than count items. */
+    template<class OutputIterator>
+    OutputIterator popBack(size_t count, OutputIterator out);
+
+    /** Visits every item from front to back without copying the deque.
+     * @pre visit does not modify the deque.
+     * @post The deque remains unchanged.
+     * @param visit Called with each item. */
+    template<class Function>
+    void forEach(Function visit) const;
+
     /** Returns a copy of the front of the deque.
      * @pre The deque is not empty.
      * @post The deque remains unchanged.
@@ -89,6 +172,12 @@ public:
      * @pre None
      * @post All nodes are removed, and the deque is empty. */
     void clear() noexcept override final;
+
+    /** Retrieves the memory resource nodes are allocated from.
+     * @pre None
+     * @post The deque remains unchanged.
+     * @return The memory resource of this deque. */
+    std::pmr::memory_resource* getMemoryResource() const noexcept;
 };
 
 #include "LinkedDeque.cpp"
@@ -0,0 +1,115 @@
+/** @file MappedFile.cpp
+ * MappedFile maps a file read-only into memory with mmap, or MapViewOfFile on Windows.
+ * @class MappedFile
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+MappedFile::MappedFile(const std::string& filename) : mappedData(nullptr), mappedSize(0), mappingHandle(nullptr)
+{
+    HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        throw std::runtime_error("Could not map empty file: " + filename);
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(fileHandle);  // The mapping keeps the file open
+    if (mappingHandle == nullptr)
+    {
+        throw std::runtime_error("Could not map file: " + filename);
+    }
+
+    mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (mappedData == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        throw std::runtime_error("Could not map file: " + filename);
+    }
+    mappedSize = static_cast<size_t>(fileSize.QuadPart);
+} // end constructor
+
+void MappedFile::unmap() noexcept
+{
+    if (mappedData != nullptr)
+    {
+        UnmapViewOfFile(mappedData);
+        CloseHandle(mappingHandle);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+} // end unmap
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filename) : mappedData(nullptr), mappedSize(0)
+{
+    int fileDescriptor = open(filename.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        close(fileDescriptor);
+        throw std::runtime_error("Could not map empty file: " + filename);
+    }
+
+    void* address = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);  // The mapping keeps the file open
+    if (address == MAP_FAILED)
+    {
+        throw std::runtime_error("Could not map file: " + filename);
+    }
+
+    mappedData = address;
+    mappedSize = static_cast<size_t>(fileStatus.st_size);
+} // end constructor
+
+void MappedFile::unmap() noexcept
+{
+    if (mappedData != nullptr)
+    {
+        munmap(const_cast<void*>(mappedData), mappedSize);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+} // end unmap
+#endif
+
+MappedFile::~MappedFile()
+{
+    unmap();
+} // end destructor
+
+const void* MappedFile::data() const noexcept
+{
+    return mappedData;
+} // end data
+
+size_t MappedFile::size() const noexcept
+{
+    return mappedSize;
+} // end size
@@ -0,0 +1,65 @@
+/** @file MappedFile.h
+ * @class MappedFile
+ * Maps a whole file read-only into memory so its contents can be used in place without reading or copying them. The mapping is released when the object is destroyed.
+ */
+
+#ifndef MAPPED_FILE_
+#define MAPPED_FILE_
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+class MappedFile
+{
+private:
+    /** Start of the mapped bytes, or nullptr if nothing is mapped. */
+    const void* mappedData;
+
+    /** Number of mapped bytes. */
+    size_t mappedSize;
+
+#ifdef _WIN32
+    /** Handle of the file mapping object. */
+    void* mappingHandle;
+#endif
+
+    /** Helper function to release the mapping.
+     * @pre None
+     * @post Nothing is mapped. */
+    void unmap() noexcept;
+
+public:
+    /** Maps a file read-only.
+     * @pre None
+     * @post The whole file is mapped into memory. File is unchanged.
+     * @param filename The name of the file to map.
+     * @throw std::runtime_error If the file cannot be opened, is empty, or cannot be mapped. */
+    explicit MappedFile(const std::string& filename);
+
+    /** Mappings cannot be copied. */
+    MappedFile(const MappedFile&) = delete;
+
+    /** Mappings cannot be copied. */
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** Destructor releases the mapping.
+     * @pre None
+     * @post The file is no longer mapped. */
+    ~MappedFile();
+
+    /** Retrieves the mapped bytes.
+     * @pre None
+     * @post The mapping is unchanged.
+     * @return A pointer to the first mapped byte. */
+    const void* data() const noexcept;
+
+    /** Retrieves the size of the mapping.
+     * @pre None
+     * @post The mapping is unchanged.
+     * @return The number of mapped bytes. */
+    size_t size() const noexcept;
+};
+
+#include "MappedFile.cpp"
+#endif
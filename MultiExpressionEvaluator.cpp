@@ -0,0 +1,147 @@
+/** @file MultiExpressionEvaluator.cpp
+ * MultiExpressionEvaluator groups formulas by structure and evaluates each group across lanes.
+ * @class MultiExpressionEvaluator
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "MultiExpressionEvaluator.h"
+
+MultiExpressionEvaluator::MultiExpressionEvaluator() : formulaCount(0)
+{ } // end default constructor
+
+size_t MultiExpressionEvaluator::addFormula(const std::string& postfixExpression)
+{
+    CompiledExpression compiled(postfixExpression);
+
+    // The shape replaces every variable with 'v', so a+b*c and d+e*f share one group
+    std::string shape;
+    std::vector<std::uint8_t> variables;
+    for (char currentChar : compiled.getPostfixExpression())
+    {
+        if (currentChar >= 'a' && currentChar <= 'z')
+        {
+            shape += 'v';
+            variables.push_back(static_cast<std::uint8_t>(currentChar - 'a'));
+        }
+        else
+        {
+            shape += currentChar;
+        }
+    }
+
+    auto existing = groupLookup.find(shape);
+    size_t groupIndex;
+    if (existing == groupLookup.end())
+    {
+        groupIndex = groups.size();
+        groups.emplace_back();
+        groups.back().shape = shape;
+        groups.back().operandCount = variables.size();
+        groups.back().maxStackDepth = compiled.getMaxStackDepth();
+        groupLookup.emplace(shape, groupIndex);
+    }
+    else
+    {
+        groupIndex = existing->second;
+    }
+
+    // Appending lane-major keeps adding amortized O(1), evaluate transposes the table once before it is used
+    ShapeGroup& group = groups[groupIndex];
+    group.laneVariables.insert(group.laneVariables.end(), variables.begin(), variables.end());
+    group.laneFormulas.push_back(formulaCount);
+
+    return formulaCount++;
+} // end addFormula
+
+void MultiExpressionEvaluator::evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<FormulaResult>& results)
+{
+    double row[CompiledExpression::VARIABLE_CAPACITY];
+    for (size_t i = 0; i < CompiledExpression::VARIABLE_CAPACITY; ++i)
+    {
+        row[i] = variableValues[i];
+    }
+
+    results.resize(formulaCount);
+
+    for (ShapeGroup& group : groups)
+    {
+        const size_t lanes = group.laneFormulas.size();
+        if (group.transposedLanes != lanes)
+        {
+            group.operandVariables.resize(group.operandCount * lanes);
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                for (size_t operand = 0; operand < group.operandCount; ++operand)
+                {
+                    group.operandVariables[operand * lanes + lane] = group.laneVariables[lane * group.operandCount + operand];
+                }
+            }
+            group.transposedLanes = lanes;
+        }
+        laneStack.resize(group.maxStackDepth * lanes);
+        laneFailed.assign(lanes, 0);
+
+        double* stack = laneStack.data();
+        std::uint8_t* failed = laneFailed.data();
+        size_t depth = 0;
+        size_t operand = 0;
+
+        for (char instruction : group.shape)
+        {
+            if (instruction == 'v')
+            {
+                // Gather this operand's variable for every lane
+                double* destination = stack + depth * lanes;
+                const std::uint8_t* variables = group.operandVariables.data() + operand * lanes;
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    destination[lane] = row[variables[lane]];
+                }
+                ++depth;
+                ++operand;
+                continue;
+            }
+
+            double* left = stack + (depth - 2) * lanes;
+            const double* right = stack + (depth - 1) * lanes;
+            switch (instruction)
+            {
+            case '+':
+                for (size_t lane = 0; lane < lanes; ++lane) left[lane] = left[lane] + right[lane];
+                break;
+            case '-':
+                for (size_t lane = 0; lane < lanes; ++lane) left[lane] = left[lane] - right[lane];
+                break;
+            case '*':
+                for (size_t lane = 0; lane < lanes; ++lane) left[lane] = left[lane] * right[lane];
+                break;
+            default:
+                // Branch-free so the loop vectorizes: divide every lane and flag the lanes that divided by zero
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    failed[lane] |= static_cast<std::uint8_t>(right[lane] == 0);
+                    left[lane] = left[lane] / right[lane];
+                }
+                break;
+            }
+            --depth;
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            results[group.laneFormulas[lane]] = FormulaResult{ stack[lane], failed[lane] == 0 };
+        }
+    }
+} // end evaluate
+
+size_t MultiExpressionEvaluator::getFormulaCount() const noexcept
+{
+    return formulaCount;
+} // end getFormulaCount
+
+size_t MultiExpressionEvaluator::getGroupCount() const noexcept
+{
+    return groups.size();
+} // end getGroupCount
@@ -0,0 +1,90 @@
+/** @file MultiExpressionEvaluator.h
+ * @class MultiExpressionEvaluator
+ * Evaluates many formulas on a single variable row at once. Formulas with the same structure (same operators in the same places, possibly different variables) are grouped, and each group runs its shared instruction sequence across all of its formulas as lanes. Operands are gathered from the row per lane, and every instruction is a simple loop over lanes that the compiler turns into SIMD code.
+ */
+
+#ifndef MULTI_EXPRESSION_EVALUATOR_
+#define MULTI_EXPRESSION_EVALUATOR_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "CompiledExpression.h"
+#include "FormulaResult.h"
+
+class MultiExpressionEvaluator
+{
+private:
+    /** Formulas that share one structure. */
+    struct ShapeGroup
+    {
+        /** Shape instructions: 'v' loads the next operand, anything else is an operator. */
+        std::string shape;
+
+        /** Number of variable operands per formula. */
+        size_t operandCount = 0;
+
+        /** Largest number of operands on the stack at once. */
+        size_t maxStackDepth = 0;
+
+        /** Formula held by each lane. */
+        std::vector<size_t> laneFormulas;
+
+        /** Variable index of each operand as formulas are added, stored lane-major: laneVariables[lane * operandCount + operand]. */
+        std::vector<std::uint8_t> laneVariables;
+
+        /** The same table transposed for evaluation, stored operand-major: operandVariables[operand * lanes + lane]. */
+        std::vector<std::uint8_t> operandVariables;
+
+        /** Number of lanes operandVariables was built for. */
+        size_t transposedLanes = 0;
+    };
+
+    /** Every group of structurally identical formulas. */
+    std::vector<ShapeGroup> groups;
+
+    /** Maps a shape to its group. */
+    std::unordered_map<std::string, size_t> groupLookup;
+
+    /** Number of formulas added. */
+    size_t formulaCount;
+
+    /** Scratch operand stack, stored slot-major: stack[slot * lanes + lane]. */
+    std::vector<double> laneStack;
+
+    /** Scratch flag of each lane that divided by zero. */
+    std::vector<std::uint8_t> laneFailed;
+
+public:
+    /** Creates an evaluator with no formulas. */
+    MultiExpressionEvaluator();
+
+    /** Adds a formula, placing it in the group of formulas with the same structure.
+     * @pre None
+     * @post The formula is the last formula of the evaluator.
+     * @param postfixExpression A postfix expression produced by convertInfixToPostfix.
+     * @return The position of the formula.
+     * @throws std::runtime_error If the postfix expression is invalid.
+     * @throws std::runtime_error If an unknown operator is encountered. */
+    size_t addFormula(const std::string& postfixExpression);
+
+    /** Evaluates every formula on one variable row. The first call after formulas were added rebuilds the operand-major tables of the groups that grew.
+     * @pre None
+     * @post results holds one entry per formula, in the order they were added. Not safe to call concurrently on one evaluator.
+     * @param variableValues The values of variables a-f.
+     * @param results Receives the result of each formula. */
+    void evaluate(const CompiledExpression::VariableArray& variableValues, std::vector<FormulaResult>& results);
+
+    /** Retrieves the number of formulas.
+     * @return The number of formulas added. */
+    size_t getFormulaCount() const noexcept;
+
+    /** Retrieves the number of distinct structures.
+     * @return The number of groups the formulas were split into. */
+    size_t getGroupCount() const noexcept;
+};
+
+#include "MultiExpressionEvaluator.cpp"
+#endif
@@ -45,6 +45,12 @@ ItemType Node<ItemType>::getItem() const noexcept
     return item;
 }  // end getItem
 
+template<class ItemType>
+ItemType Node<ItemType>::takeItem() noexcept
+{
+    return std::move(item);
+}  // end takeItem
+
 template<class ItemType>
 auto Node<ItemType>::getNext() const noexcept
 {
@@ -59,6 +59,12 @@ public:
      * @return The item stored in the node. */
     ItemType getItem() const noexcept;
 
+    /** Moves the item out of the node.
+     * @pre None
+     * @post The item is left in a valid but unspecified state.
+     * @return The item stored in the node. */
+    ItemType takeItem() noexcept;
+
     /** Retrieves the next node in the list.
      * @pre None
      * @post The node is unchanged.
@@ -0,0 +1,305 @@
+/** @file PersistentDeque.cpp
+ * @class PersistentDeque
+ * Implements an immutable deque with a shared 2-3 finger tree.
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "PersistentDeque.h"
+#include "PrecondViolatedExcept.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+template<class ItemType>
+PersistentDeque<ItemType>::PersistentDeque() noexcept : root(nullptr), itemCount(0)
+{ } // end default constructor
+
+template<class ItemType>
+PersistentDeque<ItemType>::PersistentDeque(SpinePointer spine, int length) noexcept : root(std::move(spine)), itemCount(length)
+{ } // end spine constructor
+
+template<class ItemType>
+template<class InputIterator>
+PersistentDeque<ItemType>::PersistentDeque(InputIterator first, InputIterator last) : PersistentDeque()
+{
+    for (; first != last; ++first)
+    {
+        root = pushBack(root, std::make_shared<const Leaf>(*first));
+        itemCount++;
+    }
+} // end range constructor
+
+template<class ItemType>
+PersistentDeque<ItemType>::PersistentDeque(PersistentDeque<ItemType>&& originalDeque) noexcept
+    : root(std::move(originalDeque.root)), itemCount(std::exchange(originalDeque.itemCount, 0))
+{ } // end move constructor
+
+template<class ItemType>
+PersistentDeque<ItemType>& PersistentDeque<ItemType>::operator=(PersistentDeque<ItemType> originalDeque) noexcept
+{
+    // The parameter takes the old tree and releases it when it goes out of scope
+    std::swap(root, originalDeque.root);
+    std::swap(itemCount, originalDeque.itemCount);
+    return *this;
+} // end assignment
+
+template<class ItemType>
+PersistentDeque<ItemType>::~PersistentDeque()
+{ } // end destructor
+
+template<class ItemType>
+typename PersistentDeque<ItemType>::SpinePointer PersistentDeque<ItemType>::pushFront(const SpinePointer& spine, ElementPointer element)
+{
+    if (spine == nullptr)
+    {
+        return std::make_shared<const Spine>(Spine{ { { std::move(element) }, 1 }, nullptr, { {}, 0 } });
+    }
+    if (spine->suffix.count == 0)  // A single element becomes the suffix
+    {
+        return std::make_shared<const Spine>(Spine{ { { std::move(element) }, 1 }, nullptr, { { spine->prefix.elements[0] }, 1 } });
+    }
+
+    Spine newSpine = *spine;
+    Digit& prefix = newSpine.prefix;
+    if (prefix.count == 4)
+    {
+        // Carry the last three elements into the middle as one branch, leaving room at the front
+        auto carried = std::make_shared<Branch>();
+        carried->children = { prefix.elements[1], prefix.elements[2], prefix.elements[3] };
+        carried->childCount = 3;
+        newSpine.middle = pushFront(spine->middle, std::move(carried));
+        prefix.elements[2] = nullptr;
+        prefix.elements[3] = nullptr;
+        prefix.count = 1;
+    }
+    for (int i = prefix.count; i > 0; --i)
+    {
+        prefix.elements[i] = std::move(prefix.elements[i - 1]);
+    }
+    prefix.elements[0] = std::move(element);
+    prefix.count++;
+    return std::make_shared<const Spine>(std::move(newSpine));
+} // end pushFront
+
+template<class ItemType>
+typename PersistentDeque<ItemType>::SpinePointer PersistentDeque<ItemType>::pushBack(const SpinePointer& spine, ElementPointer element)
+{
+    if (spine == nullptr)
+    {
+        return std::make_shared<const Spine>(Spine{ { { std::move(element) }, 1 }, nullptr, { {}, 0 } });
+    }
+    if (spine->suffix.count == 0)  // The single element stays in the prefix
+    {
+        return std::make_shared<const Spine>(Spine{ spine->prefix, nullptr, { { std::move(element) }, 1 } });
+    }
+
+    Spine newSpine = *spine;
+    Digit& suffix = newSpine.suffix;
+    if (suffix.count == 4)
+    {
+        // Carry the first three elements into the middle as one branch, leaving room at the back
+        auto carried = std::make_shared<Branch>();
+        carried->children = { suffix.elements[0], suffix.elements[1], suffix.elements[2] };
+        carried->childCount = 3;
+        newSpine.middle = pushBack(spine->middle, std::move(carried));
+        suffix.elements = { std::move(suffix.elements[3]) };
+        suffix.count = 1;
+    }
+    suffix.elements[suffix.count] = std::move(element);
+    suffix.count++;
+    return std::make_shared<const Spine>(std::move(newSpine));
+} // end pushBack
+
+template<class ItemType>
+typename PersistentDeque<ItemType>::SpinePointer PersistentDeque<ItemType>::popFront(const SpinePointer& spine)
+{
+    if (spine->suffix.count == 0)
+    {
+        return nullptr;  // The single element was removed
+    }
+
+    Spine newSpine = *spine;
+    Digit& prefix = newSpine.prefix;
+    if (prefix.count > 1)
+    {
+        for (int i = 1; i < prefix.count; ++i)
+        {
+            prefix.elements[i - 1] = std::move(prefix.elements[i]);
+        }
+        prefix.elements[--prefix.count] = nullptr;
+    }
+    else if (spine->middle != nullptr)
+    {
+        // Borrow the front branch of the middle as the new prefix
+        const Branch* borrowed = static_cast<const Branch*>(spine->middle->prefix.elements[0].get());
+        prefix = { {}, borrowed->childCount };
+        std::copy(borrowed->children.begin(), borrowed->children.begin() + borrowed->childCount, prefix.elements.begin());
+        newSpine.middle = popFront(spine->middle);
+    }
+    else if (newSpine.suffix.count == 1)
+    {
+        return std::make_shared<const Spine>(Spine{ newSpine.suffix, nullptr, { {}, 0 } });
+    }
+    else
+    {
+        // Move the front of the suffix into the prefix
+        Digit& suffix = newSpine.suffix;
+        prefix = { { std::move(suffix.elements[0]) }, 1 };
+        for (int i = 1; i < suffix.count; ++i)
+        {
+            suffix.elements[i - 1] = std::move(suffix.elements[i]);
+        }
+        suffix.elements[--suffix.count] = nullptr;
+    }
+    return std::make_shared<const Spine>(std::move(newSpine));
+} // end popFront
+
+template<class ItemType>
+typename PersistentDeque<ItemType>::SpinePointer PersistentDeque<ItemType>::popBack(const SpinePointer& spine)
+{
+    if (spine->suffix.count == 0)
+    {
+        return nullptr;  // The single element was removed
+    }
+
+    Spine newSpine = *spine;
+    Digit& suffix = newSpine.suffix;
+    if (suffix.count > 1)
+    {
+        suffix.elements[--suffix.count] = nullptr;
+    }
+    else if (spine->middle != nullptr)
+    {
+        // Borrow the back branch of the middle as the new suffix
+        const Branch* borrowed = static_cast<const Branch*>(backElement(*spine->middle).get());
+        suffix = { {}, borrowed->childCount };
+        std::copy(borrowed->children.begin(), borrowed->children.begin() + borrowed->childCount, suffix.elements.begin());
+        newSpine.middle = popBack(spine->middle);
+    }
+    else if (newSpine.prefix.count == 1)
+    {
+        return std::make_shared<const Spine>(Spine{ newSpine.prefix, nullptr, { {}, 0 } });
+    }
+    else
+    {
+        // Move the back of the prefix into the suffix
+        Digit& prefix = newSpine.prefix;
+        suffix = { { std::move(prefix.elements[prefix.count - 1]) }, 1 };
+        prefix.count--;
+    }
+    return std::make_shared<const Spine>(std::move(newSpine));
+} // end popBack
+
+template<class ItemType>
+const typename PersistentDeque<ItemType>::ElementPointer& PersistentDeque<ItemType>::backElement(const Spine& spine) noexcept
+{
+    return spine.suffix.count > 0 ? spine.suffix.elements[spine.suffix.count - 1] : spine.prefix.elements[0];
+} // end backElement
+
+template<class ItemType>
+bool PersistentDeque<ItemType>::isEmpty() const noexcept
+{
+    return itemCount == 0;
+} // end isEmpty
+
+template<class ItemType>
+int PersistentDeque<ItemType>::getLength() const noexcept
+{
+    return itemCount;
+} // end getLength
+
+template<class ItemType>
+ItemType PersistentDeque<ItemType>::peekFront() const
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to peek at the front of an empty deque.");
+    }
+    return static_cast<const Leaf*>(root->prefix.elements[0].get())->item;
+} // end peekFront
+
+template<class ItemType>
+ItemType PersistentDeque<ItemType>::peekBack() const
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to peek at the back of an empty deque.");
+    }
+    return static_cast<const Leaf*>(backElement(*root).get())->item;
+} // end peekBack
+
+template<class ItemType>
+PersistentDeque<ItemType> PersistentDeque<ItemType>::withFront(const ItemType& newEntry) const
+{
+    return PersistentDeque<ItemType>(pushFront(root, std::make_shared<const Leaf>(newEntry)), itemCount + 1);
+} // end withFront
+
+template<class ItemType>
+PersistentDeque<ItemType> PersistentDeque<ItemType>::withBack(const ItemType& newEntry) const
+{
+    return PersistentDeque<ItemType>(pushBack(root, std::make_shared<const Leaf>(newEntry)), itemCount + 1);
+} // end withBack
+
+template<class ItemType>
+PersistentDeque<ItemType> PersistentDeque<ItemType>::withoutFront() const
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to remove from the front of an empty deque.");
+    }
+    return PersistentDeque<ItemType>(popFront(root), itemCount - 1);
+} // end withoutFront
+
+template<class ItemType>
+PersistentDeque<ItemType> PersistentDeque<ItemType>::withoutBack() const
+{
+    if (isEmpty())
+    {
+        throw PrecondViolatedExcept("Attempted to remove from the back of an empty deque.");
+    }
+    return PersistentDeque<ItemType>(popBack(root), itemCount - 1);
+} // end withoutBack
+
+template<class ItemType>
+template<class Function>
+void PersistentDeque<ItemType>::visitElement(const Element* element, int depth, Function& visit)
+{
+    if (depth == 0)
+    {
+        visit(static_cast<const Leaf*>(element)->item);
+        return;
+    }
+    const Branch* branch = static_cast<const Branch*>(element);
+    for (int i = 0; i < branch->childCount; ++i)
+    {
+        visitElement(branch->children[i].get(), depth - 1, visit);
+    }
+} // end visitElement
+
+template<class ItemType>
+template<class Function>
+void PersistentDeque<ItemType>::forEach(Function visit) const
+{
+    // Prefixes run down the spine and suffixes run back up it, so collect the levels first
+    std::vector<const Spine*> levels;
+    for (const Spine* level = root.get(); level != nullptr; level = level->middle.get())
+    {
+        levels.push_back(level);
+    }
+    for (size_t depth = 0; depth < levels.size(); ++depth)
+    {
+        for (int i = 0; i < levels[depth]->prefix.count; ++i)
+        {
+            visitElement(levels[depth]->prefix.elements[i].get(), static_cast<int>(depth), visit);
+        }
+    }
+    for (size_t depth = levels.size(); depth-- > 0;)
+    {
+        for (int i = 0; i < levels[depth]->suffix.count; ++i)
+        {
+            visitElement(levels[depth]->suffix.elements[i].get(), static_cast<int>(depth), visit);
+        }
+    }
+} // end forEach
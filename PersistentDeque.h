@@ -0,0 +1,214 @@
+/** @file PersistentDeque.h
+ * @class PersistentDeque
+ * Implements an immutable deque. Every modification returns a new version and leaves the original untouched, and versions share the elements they have in common, so copying a version is O(1) and keeping many historical versions costs only the elements each one added.
+ * Items are held in a 2-3 finger tree. Each level of its spine keeps one to four elements at the front and at the back, and a shared middle tree whose elements are branches of three elements from the level above.
+ * Adding or removing an item usually touches only one end of the top level and is amortized O(1). A full or empty end carries into the next level, so the worst case is O(log n). No version is ever rebuilt, so the worst case holds however many times an old version is reused.
+ */
+
+#ifndef PERSISTENT_DEQUE_
+#define PERSISTENT_DEQUE_
+
+#include "DequeReadInterface.h"
+#include <array>
+#include <memory>
+
+template<class ItemType>
+class PersistentDeque : public DequeReadInterface<ItemType>
+{
+private:
+    /** An element of one level of the tree. Elements of the top level are leaves holding an item, and elements of every lower level are branches of elements from the level above. */
+    struct Element
+    {
+    };
+
+    /** An element holding one item. */
+    struct Leaf : Element
+    {
+        ItemType item;
+
+        explicit Leaf(const ItemType& newItem) : item(newItem) {}
+    };
+
+    using ElementPointer = std::shared_ptr<const Element>;
+
+    /** An element grouping three elements of the level above, or two after a removal. */
+    struct Branch : Element
+    {
+        std::array<ElementPointer, 3> children;
+        int childCount;
+    };
+
+    /** One to four elements at one end of a level. */
+    struct Digit
+    {
+        std::array<ElementPointer, 4> elements;
+        int count;
+    };
+
+    /** An immutable level of the spine. A level with an empty suffix holds a single element in its prefix and has no middle. */
+    struct Spine
+    {
+        Digit prefix;
+        std::shared_ptr<const Spine> middle;
+        Digit suffix;
+    };
+
+    using SpinePointer = std::shared_ptr<const Spine>;
+
+    /** Top level of the spine, or null if the deque is empty. */
+    SpinePointer root;
+
+    /** Number of items in the deque. */
+    int itemCount;
+
+    /** Helper constructor for a version made of an existing spine.
+     * @pre length is the number of items in spine. */
+    PersistentDeque(SpinePointer spine, int length) noexcept;
+
+    /** Helper function to add an element to the front of a level.
+     * @pre None
+     * @post spine is unchanged.
+     * @param spine The level, or null for an empty level.
+     * @param element The element to add.
+     * @return The new level. */
+    static SpinePointer pushFront(const SpinePointer& spine, ElementPointer element);
+
+    /** Helper function to add an element to the back of a level.
+     * @pre None
+     * @post spine is unchanged.
+     * @param spine The level, or null for an empty level.
+     * @param element The element to add.
+     * @return The new level. */
+    static SpinePointer pushBack(const SpinePointer& spine, ElementPointer element);
+
+    /** Helper function to remove the front element of a level.
+     * @pre spine is not null.
+     * @post spine is unchanged.
+     * @param spine The level.
+     * @return The new level, or null if it is empty. */
+    static SpinePointer popFront(const SpinePointer& spine);
+
+    /** Helper function to remove the back element of a level.
+     * @pre spine is not null.
+     * @post spine is unchanged.
+     * @param spine The level.
+     * @return The new level, or null if it is empty. */
+    static SpinePointer popBack(const SpinePointer& spine);
+
+    /** Helper function to retrieve the back element of a level.
+     * @pre None
+     * @post None
+     * @param spine The level.
+     * @return The back element. */
+    static const ElementPointer& backElement(const Spine& spine) noexcept;
+
+    /** Helper function to visit the items of an element from front to back.
+     * @pre depth is the number of levels below the top the element belongs to.
+     * @post None
+     * @param element The element.
+     * @param depth The level of the element.
+     * @param visit Called with a const reference to each item. */
+    template<class Function>
+    static void visitElement(const Element* element, int depth, Function& visit);
+
+public:
+    /** Default constructor initializes an empty deque.
+     * @pre None
+     * @post The deque is empty. */
+    PersistentDeque() noexcept;
+
+    /** Constructs a deque holding the items of a range, front to back.
+     * @pre None
+     * @post The deque holds copies of the items of the range in order.
+     * @param first Iterator to the first item.
+     * @param last Iterator past the last item. */
+    template<class InputIterator>
+    PersistentDeque(InputIterator first, InputIterator last);
+
+    /** Copy constructor shares the whole tree of another version.
+     * @pre None
+     * @post Both versions hold the same items. Nothing is copied.
+     * @param originalDeque The version to share. */
+    PersistentDeque(const PersistentDeque<ItemType>& originalDeque) = default;
+
+    /** Move constructor takes the tree of another version.
+     * @pre None
+     * @post originalDeque is left empty. */
+    PersistentDeque(PersistentDeque<ItemType>&& originalDeque) noexcept;
+
+    /** Assignment makes this deque share the tree of another version.
+     * @pre None
+     * @post Elements only this deque referenced are released.
+     * @param originalDeque The version to share.
+     * @return A reference to this deque. */
+    PersistentDeque<ItemType>& operator=(PersistentDeque<ItemType> originalDeque) noexcept;
+
+    /** Destructor releases the elements no other version shares. The tree is O(log n) levels deep, so releasing it does not recurse deeply.
+     * @pre None
+     * @post Shared elements stay alive for the versions still using them. */
+    virtual ~PersistentDeque();
+
+    /** Checks if the deque is empty.
+     * @pre None
+     * @post The deque remains unchanged.
+     * @return True if the deque is empty, false otherwise. */
+    bool isEmpty() const noexcept override;
+
+    /** Retrieves the number of items in the deque.
+     * @pre None
+     * @post The deque remains unchanged.
+     * @return The item count. */
+    int getLength() const noexcept;
+
+    /** Returns a copy of the front of the deque.
+     * @pre The deque is not empty.
+     * @post The deque remains unchanged.
+     * @return A copy of the front item.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    ItemType peekFront() const override;
+
+    /** Returns a copy of the back of the deque.
+     * @pre The deque is not empty.
+     * @post The deque remains unchanged.
+     * @return A copy of the back item.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    ItemType peekBack() const override;
+
+    /** Creates a version with a new entry at the front.
+     * @pre None
+     * @post This version is unchanged. The new version shares all but O(log n) elements of this one.
+     * @param newEntry The item to add.
+     * @return The new version. */
+    [[nodiscard]] PersistentDeque<ItemType> withFront(const ItemType& newEntry) const;
+
+    /** Creates a version with a new entry at the back.
+     * @pre None
+     * @post This version is unchanged. The new version shares all but O(log n) elements of this one.
+     * @param newEntry The item to add.
+     * @return The new version. */
+    [[nodiscard]] PersistentDeque<ItemType> withBack(const ItemType& newEntry) const;
+
+    /** Creates a version without the front item.
+     * @pre The deque is not empty.
+     * @post This version is unchanged.
+     * @return The new version.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    [[nodiscard]] PersistentDeque<ItemType> withoutFront() const;
+
+    /** Creates a version without the back item.
+     * @pre The deque is not empty.
+     * @post This version is unchanged.
+     * @return The new version.
+     * @throw PrecondViolatedExcept if the deque is empty. */
+    [[nodiscard]] PersistentDeque<ItemType> withoutBack() const;
+
+    /** Visits every item from front to back.
+     * @pre None
+     * @post The deque remains unchanged.
+     * @param visit Called with a const reference to each item. */
+    template<class Function>
+    void forEach(Function visit) const;
+};
+
+#include "PersistentDeque.cpp"
+#endif
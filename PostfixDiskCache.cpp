@@ -0,0 +1,310 @@
+/** @file PostfixDiskCache.cpp
+ * PostfixDiskCache stores converted postfix expressions in a content-addressed cache directory.
+ * @class PostfixDiskCache
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "PostfixDiskCache.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+PostfixDiskCache::PostfixDiskCache(const std::filesystem::path& directory, std::uintmax_t maxBytes)
+    : cacheDirectory(directory), maxCacheBytes(maxBytes), cacheBytes(0)
+{
+    std::filesystem::create_directories(cacheDirectory);
+
+    const std::filesystem::file_time_type abandonedBefore = std::filesystem::file_time_type::clock::now() - ABANDONED_TEMPORARY_AGE;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cacheDirectory))
+    {
+        std::string filename = entry.path().filename().string();
+        std::error_code error;
+        if (filename.find(".tmp") != std::string::npos)
+        {
+            // Left over from an interrupted write, unless it is recent enough to be another writer's file in progress
+            std::filesystem::file_time_type lastWrite = entry.last_write_time(error);
+            if (!error && lastWrite < abandonedBefore)
+            {
+                std::filesystem::remove(entry.path(), error);
+            }
+        }
+        else if (entry.path().extension() == ENTRY_EXTENSION)
+        {
+            cacheBytes += entry.file_size(error);
+        }
+    }
+
+    if (cacheBytes > maxCacheBytes)
+    {
+        evict();
+    }
+} // end constructor
+
+std::string PostfixDiskCache::normalize(const std::string& infixExpression)
+{
+    std::string normalizedExpression;
+    normalizedExpression.reserve(infixExpression.size());
+
+    for (char currentChar : infixExpression)
+    {
+        currentChar = std::tolower(currentChar);
+        if (std::isalpha(currentChar) || currentChar == '(' || currentChar == ')' ||
+            currentChar == '+' || currentChar == '-' || currentChar == '*' || currentChar == '/')
+        {
+            normalizedExpression += currentChar;
+        }
+    }
+    return normalizedExpression;
+} // end normalize
+
+std::string PostfixDiskCache::hashText(std::string_view text)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (unsigned char currentByte : text)
+    {
+        hash ^= currentByte;
+        hash *= 1099511628211ull;
+    }
+
+    static const char hexDigits[] = "0123456789abcdef";
+    std::string hexHash(16, '0');
+    for (int i = 15; i >= 0; --i)
+    {
+        hexHash[i] = hexDigits[hash & 0xF];
+        hash >>= 4;
+    }
+    return hexHash;
+} // end hashText
+
+std::filesystem::path PostfixDiskCache::entryPath(const std::string& normalizedExpression) const
+{
+    // Keyed on the converter version as well as the normalized text
+    std::string keyText = std::to_string(InfixToPostfixEvaluation::CONVERTER_VERSION) + '\0' + normalizedExpression;
+    return cacheDirectory / (hashText(keyText) + ENTRY_EXTENSION);
+} // end entryPath
+
+bool PostfixDiskCache::lookup(const std::string& infixExpression, std::string& postfixExpression)
+{
+    std::string normalizedExpression = normalize(infixExpression);
+    std::filesystem::path path = entryPath(normalizedExpression);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad())
+    {
+        return false;
+    }
+
+    // Entry layout: a version line, the normalized expression, the postfix expression, and a checksum of the lines before it.
+    // Every line must end in a newline, so an entry cut short anywhere fails to parse or fails its checksum
+    std::string_view lines[4];
+    size_t lineStart = 0;
+    for (std::string_view& line : lines)
+    {
+        size_t lineEnd = contents.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+        {
+            return false;
+        }
+        line = std::string_view(contents).substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+    }
+    size_t checkedLength = contents.size() - lines[3].size() - 1;
+    if (lineStart != contents.size() || lines[3] != hashText(std::string_view(contents).substr(0, checkedLength)))
+    {
+        return false;  // Truncated, padded, or damaged entry
+    }
+    if (lines[0] != "PFXCACHE " + std::to_string(InfixToPostfixEvaluation::CONVERTER_VERSION) ||
+        lines[1] != normalizedExpression)  // Hash collision or stale entry
+    {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);  // Mark as recently used
+    postfixExpression = lines[2];
+    return true;
+} // end lookup
+
+bool PostfixDiskCache::writeDurably(const std::filesystem::path& path, const std::string& contents)
+{
+#ifdef _WIN32
+    int descriptor = _wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    bool written = true;
+    size_t offset = 0;
+    while (written && offset < contents.size())
+    {
+#ifdef _WIN32
+        int count = _write(descriptor, contents.data() + offset, static_cast<unsigned int>(contents.size() - offset));
+#else
+        ssize_t count = write(descriptor, contents.data() + offset, contents.size() - offset);
+#endif
+        if (count < 0 && errno != EINTR)
+        {
+            written = false;
+        }
+        else if (count > 0)
+        {
+            offset += static_cast<size_t>(count);
+        }
+    }
+
+#ifdef _WIN32
+    written = written && _commit(descriptor) == 0;
+    written = _close(descriptor) == 0 && written;
+#else
+    written = written && fsync(descriptor) == 0;
+    written = close(descriptor) == 0 && written;
+#endif
+    return written;
+} // end writeDurably
+
+void PostfixDiskCache::syncDirectory() const
+{
+#ifndef _WIN32
+    int descriptor = open(cacheDirectory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (descriptor >= 0)
+    {
+        fsync(descriptor);  // Some file systems cannot sync a directory, the entry is still in place
+        close(descriptor);
+    }
+#endif
+} // end syncDirectory
+
+bool PostfixDiskCache::store(const std::string& infixExpression, const std::string& postfixExpression)
+{
+    static std::atomic<unsigned> writeCounter{ 0 };
+
+    std::string normalizedExpression = normalize(infixExpression);
+    std::filesystem::path path = entryPath(normalizedExpression);
+
+    // Unique temporary name so concurrent writers in other threads or processes never share a file
+    std::size_t writerId = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+        static_cast<std::size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp" + std::to_string(writerId) + "_" + std::to_string(writeCounter++);
+
+    std::string contents = "PFXCACHE " + std::to_string(InfixToPostfixEvaluation::CONVERTER_VERSION) + "\n" +
+        normalizedExpression + "\n" + postfixExpression + "\n";
+    contents += hashText(contents) + "\n";
+
+    // The entry must be on disk before it is renamed into place, or a crash could leave a visible but empty entry
+    std::error_code error;
+    if (!writeDurably(temporaryPath, contents))
+    {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+
+    // Renaming over the entry is atomic, so readers see either the old entry or the complete new one
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    syncDirectory();  // Make the rename itself durable
+
+    cacheBytes += contents.size();
+    if (cacheBytes > maxCacheBytes)
+    {
+        evict();
+    }
+    return true;
+} // end store
+
+bool PostfixDiskCache::convert(InfixToPostfixEvaluation& evaluator, const std::string& infixExpression)
+{
+    std::string postfixExpression;
+    if (lookup(infixExpression, postfixExpression))
+    {
+        evaluator.loadPostfixExpression(postfixExpression);
+        return true;
+    }
+
+    evaluator.convertInfixToPostfix(infixExpression);
+    store(infixExpression, evaluator.getPostfixExpression());
+    return false;
+} // end convert
+
+void PostfixDiskCache::evict()
+{
+    struct CacheEntry
+    {
+        std::filesystem::path path;
+        std::filesystem::file_time_type lastUsed;
+        std::uintmax_t size;
+    };
+
+    // Rescan so entries written by other processes are counted
+    std::vector<CacheEntry> entries;
+    cacheBytes = 0;
+    std::error_code error;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cacheDirectory, error))
+    {
+        if (entry.path().extension() == ENTRY_EXTENSION)
+        {
+            CacheEntry cacheEntry{ entry.path(), entry.last_write_time(error), entry.file_size(error) };
+            if (!error)
+            {
+                entries.push_back(cacheEntry);
+                cacheBytes += cacheEntry.size;
+            }
+        }
+    }
+
+    // Remove the least recently used entries first
+    std::sort(entries.begin(), entries.end(),
+        [](const CacheEntry& first, const CacheEntry& second) { return first.lastUsed < second.lastUsed; });
+    for (const CacheEntry& entry : entries)
+    {
+        if (cacheBytes <= maxCacheBytes)
+        {
+            break;
+        }
+        if (std::filesystem::remove(entry.path, error))
+        {
+            cacheBytes -= entry.size;
+        }
+    }
+} // end evict
+
+void PostfixDiskCache::clear()
+{
+    std::error_code error;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cacheDirectory, error))
+    {
+        if (entry.path().extension() == ENTRY_EXTENSION)
+        {
+            std::filesystem::remove(entry.path(), error);
+        }
+    }
+    cacheBytes = 0;
+} // end clear
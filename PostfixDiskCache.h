@@ -0,0 +1,113 @@
+/** @file PostfixDiskCache.h
+ * @class PostfixDiskCache
+ * Content-addressed on-disk cache of converted postfix expressions, so conversions survive restarts. Each entry is stored under a hash of the normalized infix text and the converter version. Entries are written to a temporary file, synced to disk, and renamed into place, and the directory is synced after the rename, so a crash never leaves a partial entry visible. Each entry ends with a checksum of its contents, so an entry damaged on disk is treated as a miss. The least recently used entries are evicted once the cache grows past its size limit.
+ */
+
+#ifndef POSTFIX_DISK_CACHE_
+#define POSTFIX_DISK_CACHE_
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include "InfixToPostfixEvaluation.h"
+
+class PostfixDiskCache
+{
+private:
+    /** File name extension of cache entries. */
+    static constexpr const char* ENTRY_EXTENSION = ".pfx";
+
+    /** Age after which a temporary file is taken to be left by an interrupted write. Younger ones may belong to a write still in progress in another process. */
+    static constexpr std::chrono::minutes ABANDONED_TEMPORARY_AGE{ 10 };
+
+    /** Directory holding the cache entries. */
+    std::filesystem::path cacheDirectory;
+
+    /** Largest total size of the entries, in bytes, before older entries are evicted. */
+    std::uintmax_t maxCacheBytes;
+
+    /** Running estimate of the total size of the entries, in bytes. */
+    std::uintmax_t cacheBytes;
+
+    /** Helper function to hash text with 64-bit FNV-1a, which is stable across runs and platforms.
+     * @pre None
+     * @post None
+     * @param text The text to hash.
+     * @return The hash written as 16 hexadecimal digits. */
+    static std::string hashText(std::string_view text);
+
+    /** Helper function to compute the file holding the entry for a normalized expression.
+     * @pre None
+     * @post None
+     * @param normalizedExpression The normalized infix expression.
+     * @return The path of the entry. */
+    std::filesystem::path entryPath(const std::string& normalizedExpression) const;
+
+    /** Helper function to write a file and sync it to disk.
+     * @pre None
+     * @post On success the file holds contents and they have reached the disk.
+     * @param path The file to create or replace.
+     * @param contents The bytes to write.
+     * @return True if every byte was written and synced, or false if not. */
+    static bool writeDurably(const std::filesystem::path& path, const std::string& contents);
+
+    /** Helper function to sync the cache directory, so a rename into it survives a crash. Does nothing on Windows, where renames are journaled.
+     * @pre None
+     * @post The directory's entries have reached the disk, if the file system supports syncing a directory. */
+    void syncDirectory() const;
+
+    /** Helper function to remove the least recently used entries until the cache fits its size limit.
+     * @pre None
+     * @post The total size of the entries is at most maxCacheBytes. */
+    void evict();
+
+public:
+    /** Opens a cache directory, creating it if needed, and removes temporary files left by interrupted writes. Only temporary files older than ABANDONED_TEMPORARY_AGE are removed, so writes other processes have in flight are left alone.
+     * @pre None
+     * @post The cache directory exists.
+     * @param directory The directory holding the cache entries.
+     * @param maxBytes The largest total size of the entries, in bytes.
+     * @throws std::filesystem::filesystem_error If the directory cannot be created or read. */
+    PostfixDiskCache(const std::filesystem::path& directory, std::uintmax_t maxBytes);
+
+    /** Normalizes an infix expression by lowercasing it and dropping every character convertInfixToPostfix ignores.
+     * @pre None
+     * @post None
+     * @param infixExpression The infix expression to normalize.
+     * @return The normalized expression. Expressions with the same normalized text convert to the same postfix expression. */
+    static std::string normalize(const std::string& infixExpression);
+
+    /** Looks up the postfix expression converted from an infix expression.
+     * @pre None
+     * @post On a hit the entry is marked as recently used.
+     * @param infixExpression The infix expression to look up.
+     * @param postfixExpression Receives the cached postfix expression on a hit.
+     * @return True if the cache held a complete entry whose checksum matches, or false if not. */
+    bool lookup(const std::string& infixExpression, std::string& postfixExpression);
+
+    /** Stores the postfix expression converted from an infix expression.
+     * @pre postfixExpression is the result of converting infixExpression.
+     * @post The entry is visible to later lookups, including from other processes.
+     * @param infixExpression The infix expression that was converted.
+     * @param postfixExpression The converted postfix expression.
+     * @return True if the entry was written, or false if the write failed. */
+    bool store(const std::string& infixExpression, const std::string& postfixExpression);
+
+    /** Converts an infix expression with an evaluator, consulting the cache first and populating it afterwards.
+     * @pre Assumes infix expression is valid.
+     * @post The evaluator holds the postfix expression of infixExpression.
+     * @param evaluator The evaluator that holds the converted expression.
+     * @param infixExpression The infix expression to convert.
+     * @return True if the conversion was served from the cache, or false if it ran shunting-yard. */
+    bool convert(InfixToPostfixEvaluation& evaluator, const std::string& infixExpression);
+
+    /** Removes every entry from the cache.
+     * @pre None
+     * @post The cache directory holds no entries. */
+    void clear();
+};
+
+#include "PostfixDiskCache.cpp"
+#endif
@@ -0,0 +1,114 @@
+/** @file ProgramImage.cpp
+ * ProgramImage validates a binary image of compiled postfix programs and evaluates them in place.
+ * @class ProgramImage
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ProgramImage.h"
+#include <algorithm>
+
+ProgramImage::ProgramImage(const void* data, size_t size)
+    : imageData(static_cast<const unsigned char*>(data)), header(nullptr), index(nullptr)
+{
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        throw std::runtime_error("Program images are read in place, which needs a little-endian host");
+    }
+    if (size < sizeof(ImageHeader))
+    {
+        throw std::runtime_error("Program image is too small");
+    }
+
+    header = reinterpret_cast<const ImageHeader*>(imageData);
+    if (std::string_view(header->magic, 4) != "PFXP")
+    {
+        throw std::runtime_error("Not a program image");
+    }
+    if (header->version != FORMAT_VERSION)
+    {
+        throw std::runtime_error("Unsupported program image version: " + std::to_string(header->version));
+    }
+
+    // Every section must lie inside the image, computed in 64 bits so offsets cannot wrap
+    std::uint64_t indexEnd = std::uint64_t(header->indexOffset) + std::uint64_t(header->expressionCount) * sizeof(ImageIndexEntry);
+    std::uint64_t stringTableEnd = std::uint64_t(header->stringTableOffset) + header->stringTableSize;
+    std::uint64_t codeEnd = std::uint64_t(header->codeOffset) + header->codeSize;
+    if (header->indexOffset % alignof(ImageIndexEntry) != 0 || indexEnd > size || stringTableEnd > size || codeEnd > size)
+    {
+        throw std::runtime_error("Program image section is out of bounds");
+    }
+
+    index = reinterpret_cast<const ImageIndexEntry*>(imageData + header->indexOffset);
+    for (std::uint32_t i = 0; i < header->expressionCount; ++i)
+    {
+        const ImageIndexEntry& entry = index[i];
+        if (std::uint64_t(entry.infixOffset) + entry.infixLength > header->stringTableSize ||
+            std::uint64_t(entry.codeOffset) + entry.codeLength > header->codeSize)
+        {
+            throw std::runtime_error("Program image entry " + std::to_string(i) + " is out of bounds");
+        }
+
+        // Replay the stack depth so evaluate can run the bytecode without checks. maxStackDepth sizes the evaluation
+        // stack, so it must be exactly the deepest stack the program reaches, not just an upper bound
+        using Opcode = CompiledExpression::Opcode;
+        const std::uint8_t* code = imageData + header->codeOffset + entry.codeOffset;
+        std::uint64_t depth = 0;
+        std::uint64_t deepest = 0;
+        for (std::uint32_t j = 0; j < entry.codeLength; ++j)
+        {
+            if (code[j] > static_cast<std::uint8_t>(Opcode::Divide))
+            {
+                throw std::runtime_error("Program image entry " + std::to_string(i) + " has an invalid opcode");
+            }
+            if (code[j] >= static_cast<std::uint8_t>(Opcode::Add))
+            {
+                if (depth < 2)
+                {
+                    throw std::runtime_error("Program image entry " + std::to_string(i) + " has an operator without two operands");
+                }
+                --depth;
+            }
+            else
+            {
+                deepest = std::max(deepest, ++depth);
+            }
+        }
+        if (depth != 1)
+        {
+            throw std::runtime_error("Program image entry " + std::to_string(i) + " does not leave exactly one result");
+        }
+        if (deepest != entry.maxStackDepth)
+        {
+            throw std::runtime_error("Program image entry " + std::to_string(i) + " has the wrong stack depth");
+        }
+    }
+} // end constructor
+
+size_t ProgramImage::getExpressionCount() const noexcept
+{
+    return header->expressionCount;
+} // end getExpressionCount
+
+std::string_view ProgramImage::getInfixExpression(size_t expressionIndex) const
+{
+    if (expressionIndex >= header->expressionCount)
+    {
+        throw std::out_of_range("Program image has no expression " + std::to_string(expressionIndex));
+    }
+    const ImageIndexEntry& entry = index[expressionIndex];
+    const char* stringTable = reinterpret_cast<const char*>(imageData + header->stringTableOffset);
+    return std::string_view(stringTable + entry.infixOffset, entry.infixLength);
+} // end getInfixExpression
+
+double ProgramImage::evaluate(size_t expressionIndex, const CompiledExpression::VariableArray& variableValues) const
+{
+    if (expressionIndex >= header->expressionCount)
+    {
+        throw std::out_of_range("Program image has no expression " + std::to_string(expressionIndex));
+    }
+    const ImageIndexEntry& entry = index[expressionIndex];
+    const std::uint8_t* code = imageData + header->codeOffset + entry.codeOffset;
+    return BytecodeBackend::run(code, entry.codeLength, entry.maxStackDepth, variableValues);
+} // end evaluate
@@ -0,0 +1,101 @@
+/** @file ProgramImage.h
+ * @class ProgramImage
+ * Read-only view over a binary image of compiled postfix programs. The image is position independent, so it can be evaluated in place from a mapped file or any other memory without parsing or copying.
+ *
+ * Layout (little-endian, all offsets relative to the start of the image):
+ * - ImageHeader: magic "PFXP", format version, expression count, and the offset and size of each section.
+ * - Index: one ImageIndexEntry per expression.
+ * - String table: the original infix text of every expression, not null terminated.
+ * - Instruction stream: the CompiledExpression bytecode of every expression.
+ */
+
+#ifndef PROGRAM_IMAGE_
+#define PROGRAM_IMAGE_
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include "CompiledExpression.h"
+#include "BytecodeBackend.h"
+
+class ProgramImage
+{
+public:
+    /** Format version written by ProgramImageWriter and accepted by ProgramImage. */
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /** Fixed-size header at the start of every image. */
+    struct ImageHeader
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t expressionCount;
+        std::uint32_t indexOffset;
+        std::uint32_t stringTableOffset;
+        std::uint32_t stringTableSize;
+        std::uint32_t codeOffset;
+        std::uint32_t codeSize;
+    };
+
+    /** Location of one expression inside the image. */
+    struct ImageIndexEntry
+    {
+        std::uint32_t infixOffset;   // Relative to the string table
+        std::uint32_t infixLength;
+        std::uint32_t codeOffset;    // Relative to the instruction stream
+        std::uint32_t codeLength;
+        std::uint32_t maxStackDepth;
+    };
+
+    static_assert(sizeof(ImageHeader) == 32, "ImageHeader must match the file layout");
+    static_assert(sizeof(ImageIndexEntry) == 20, "ImageIndexEntry must match the file layout");
+
+private:
+    /** Start of the image. */
+    const unsigned char* imageData;
+
+    /** The image header. */
+    const ImageHeader* header;
+
+    /** The first index entry. */
+    const ImageIndexEntry* index;
+
+public:
+    /** Validates an image and creates a view over it. The memory must outlive the view.
+     * @pre data points to size readable bytes aligned to at least 4 bytes.
+     * @post The image is unchanged.
+     * @param data Pointer to the start of the image.
+     * @param size Number of bytes in the image.
+     * @throws std::runtime_error If the host is not little-endian, since the image is read in place.
+     * @throws std::runtime_error If the header, version, or any section or index entry is out of bounds, or if any entry's bytecode
+     * has an invalid opcode, an operator without two operands, a maxStackDepth other than its deepest stack, or does not leave exactly one result. */
+    ProgramImage(const void* data, size_t size);
+
+    /** Retrieves the number of expressions in the image.
+     * @pre None
+     * @post The image is unchanged.
+     * @return The number of expressions. */
+    size_t getExpressionCount() const noexcept;
+
+    /** Retrieves the original infix text of an expression without copying it.
+     * @pre None
+     * @post The image is unchanged.
+     * @param expressionIndex The position of the expression in the image.
+     * @return A view of the infix text inside the image.
+     * @throws std::out_of_range If expressionIndex is not a valid position. */
+    std::string_view getInfixExpression(size_t expressionIndex) const;
+
+    /** Evaluates an expression in place by interpreting its bytecode.
+     * @pre None
+     * @post The image is unchanged.
+     * @param expressionIndex The position of the expression in the image.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::out_of_range If expressionIndex is not a valid position.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(size_t expressionIndex, const CompiledExpression::VariableArray& variableValues) const;
+};
+
+#include "ProgramImage.cpp"
+#endif
@@ -0,0 +1,74 @@
+/** @file ProgramImageWriter.cpp
+ * ProgramImageWriter serializes compiled expressions into a binary program image.
+ * @class ProgramImageWriter
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ProgramImageWriter.h"
+#include <cstring>
+
+size_t ProgramImageWriter::addExpression(const std::string& infixExpression, const CompiledExpression& expression)
+{
+    const std::vector<std::uint8_t>& bytecode = expression.getBytecode();
+
+    ProgramImage::ImageIndexEntry entry;
+    entry.infixOffset = static_cast<std::uint32_t>(stringTable.size());
+    entry.infixLength = static_cast<std::uint32_t>(infixExpression.size());
+    entry.codeOffset = static_cast<std::uint32_t>(code.size());
+    entry.codeLength = static_cast<std::uint32_t>(bytecode.size());
+    entry.maxStackDepth = static_cast<std::uint32_t>(expression.getMaxStackDepth());
+
+    index.push_back(entry);
+    stringTable += infixExpression;
+    code.insert(code.end(), bytecode.begin(), bytecode.end());
+    return index.size() - 1;
+} // end addExpression
+
+std::vector<unsigned char> ProgramImageWriter::build() const
+{
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        throw std::runtime_error("Program images are written from in-memory structures, which needs a little-endian host");
+    }
+
+    ProgramImage::ImageHeader header;
+    std::memcpy(header.magic, "PFXP", 4);
+    header.version = ProgramImage::FORMAT_VERSION;
+    header.expressionCount = static_cast<std::uint32_t>(index.size());
+    header.indexOffset = sizeof(header);
+    header.stringTableOffset = static_cast<std::uint32_t>(header.indexOffset + index.size() * sizeof(ProgramImage::ImageIndexEntry));
+    header.stringTableSize = static_cast<std::uint32_t>(stringTable.size());
+    header.codeOffset = header.stringTableOffset + header.stringTableSize;
+    header.codeSize = static_cast<std::uint32_t>(code.size());
+
+    std::vector<unsigned char> image(header.codeOffset + header.codeSize);
+    std::memcpy(image.data(), &header, sizeof(header));
+    if (!index.empty())
+    {
+        std::memcpy(image.data() + header.indexOffset, index.data(), index.size() * sizeof(ProgramImage::ImageIndexEntry));
+    }
+    std::memcpy(image.data() + header.stringTableOffset, stringTable.data(), stringTable.size());
+    if (!code.empty())
+    {
+        std::memcpy(image.data() + header.codeOffset, code.data(), code.size());
+    }
+    return image;
+} // end build
+
+void ProgramImageWriter::writeToFile(const std::string& filename) const
+{
+    std::vector<unsigned char> image = build();
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+    if (!file)
+    {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+} // end writeToFile
@@ -0,0 +1,51 @@
+/** @file ProgramImageWriter.h
+ * @class ProgramImageWriter
+ * Collects compiled expressions and serializes them into the binary image format read by ProgramImage.
+ */
+
+#ifndef PROGRAM_IMAGE_WRITER_
+#define PROGRAM_IMAGE_WRITER_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ProgramImage.h"
+
+class ProgramImageWriter
+{
+private:
+    /** Index entries of the expressions added so far. */
+    std::vector<ProgramImage::ImageIndexEntry> index;
+
+    /** Concatenated infix text of the expressions added so far. */
+    std::string stringTable;
+
+    /** Concatenated bytecode of the expressions added so far. */
+    std::vector<std::uint8_t> code;
+
+public:
+    /** Adds a compiled expression to the image.
+     * @pre None
+     * @post The expression is stored at the next position of the image.
+     * @param infixExpression The original infix text of the expression.
+     * @param expression The compiled form of the expression.
+     * @return The position of the expression in the image. */
+    size_t addExpression(const std::string& infixExpression, const CompiledExpression& expression);
+
+    /** Serializes every added expression into an image.
+     * @pre None
+     * @post The writer is unchanged.
+     * @return The bytes of the image.
+     * @throws std::runtime_error If the host is not little-endian, since the image is written from in-memory structures. */
+    std::vector<unsigned char> build() const;
+
+    /** Serializes every added expression into an image file.
+     * @pre None
+     * @post The file holds the image, replacing any previous contents.
+     * @param filename The name of the file to write.
+     * @throw std::runtime_error If the file cannot be written. */
+    void writeToFile(const std::string& filename) const;
+};
+
+#include "ProgramImageWriter.cpp"
+#endif
@@ -0,0 +1,252 @@
+/** @file RegisterProgram.cpp
+ * RegisterProgram lowers bytecode into three-address register instructions and interprets them.
+ * @class RegisterProgram
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "RegisterProgram.h"
+#include <limits>
+
+// Fused instructions must round the product before adding, exactly like separate instructions,
+// so the compiler must not contract them into hardware fused multiply-add
+#if defined(__clang__)
+#define REGISTER_PROGRAM_NO_CONTRACT
+#define REGISTER_PROGRAM_CONTRACT_OFF _Pragma("clang fp contract(off)")
+#elif defined(__GNUC__)
+#define REGISTER_PROGRAM_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#define REGISTER_PROGRAM_CONTRACT_OFF
+#else
+#define REGISTER_PROGRAM_NO_CONTRACT
+#define REGISTER_PROGRAM_CONTRACT_OFF
+#endif
+
+RegisterProgram::RegisterProgram(const CompiledExpression& expression)
+    : registerCount(CompiledExpression::VARIABLE_CAPACITY + expression.getMaxStackDepth()), fusedInstructionCount(0)
+{
+    if (registerCount > std::numeric_limits<std::uint16_t>::max())
+    {
+        throw std::length_error("Expression needs too many registers");
+    }
+
+    // Simulate the operand stack with register names. Variables already live in registers 0-5,
+    // so loads emit nothing, and stack slot k lives in register VARIABLE_CAPACITY + k.
+    std::vector<std::uint16_t> operandRegisters;
+    instructions.reserve(expression.getBytecode().size() + 1);
+
+    for (std::uint8_t instruction : expression.getBytecode())
+    {
+        auto opcode = static_cast<CompiledExpression::Opcode>(instruction);
+        if (opcode < CompiledExpression::Opcode::Add)
+        {
+            operandRegisters.push_back(instruction);
+            continue;
+        }
+
+        std::uint16_t source2 = operandRegisters.back();
+        operandRegisters.pop_back();
+        std::uint16_t source1 = operandRegisters.back();
+        operandRegisters.pop_back();
+        auto destination = static_cast<std::uint16_t>(CompiledExpression::VARIABLE_CAPACITY + operandRegisters.size());
+
+        RegisterOpcode registerOpcode = RegisterOpcode::Add;
+        switch (opcode)
+        {
+        case CompiledExpression::Opcode::Add: registerOpcode = RegisterOpcode::Add; break;
+        case CompiledExpression::Opcode::Subtract: registerOpcode = RegisterOpcode::Subtract; break;
+        case CompiledExpression::Opcode::Multiply: registerOpcode = RegisterOpcode::Multiply; break;
+        default: registerOpcode = RegisterOpcode::Divide; break;
+        }
+
+        instructions.push_back(RegisterInstruction{ registerOpcode, destination, source1, source2, 0 });
+        operandRegisters.push_back(destination);
+    }
+
+    instructions.push_back(RegisterInstruction{ RegisterOpcode::Return, operandRegisters.back(), 0, 0, 0 });
+    fuseSuperinstructions();
+} // end constructor
+
+void RegisterProgram::fuseSuperinstructions()
+{
+    std::vector<RegisterInstruction> fused;
+    fused.reserve(instructions.size());
+
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const RegisterInstruction& current = instructions[i];
+        if (current.opcode == RegisterOpcode::Multiply && i + 1 < instructions.size())
+        {
+            // A stack register is read exactly once, so the product is dead after the next instruction uses it
+            const RegisterInstruction& next = instructions[i + 1];
+            std::uint16_t product = current.destination;
+            bool fusedPair = true;
+
+            if (next.opcode == RegisterOpcode::Add && next.source1 == product)
+            {
+                fused.push_back(RegisterInstruction{ RegisterOpcode::MultiplyAdd, next.destination, current.source1, current.source2, next.source2 });
+            }
+            else if (next.opcode == RegisterOpcode::Add && next.source2 == product)
+            {
+                // Addition is commutative, so z + x * y is the same as x * y + z
+                fused.push_back(RegisterInstruction{ RegisterOpcode::MultiplyAdd, next.destination, current.source1, current.source2, next.source1 });
+            }
+            else if (next.opcode == RegisterOpcode::Subtract && next.source1 == product)
+            {
+                fused.push_back(RegisterInstruction{ RegisterOpcode::MultiplySubtract, next.destination, current.source1, current.source2, next.source2 });
+            }
+            else if (next.opcode == RegisterOpcode::Subtract && next.source2 == product)
+            {
+                fused.push_back(RegisterInstruction{ RegisterOpcode::SubtractMultiply, next.destination, current.source1, current.source2, next.source1 });
+            }
+            else
+            {
+                fusedPair = false;
+            }
+
+            if (fusedPair)
+            {
+                ++fusedInstructionCount;
+                ++i;  // The consumer was folded into the superinstruction
+                continue;
+            }
+        }
+        fused.push_back(current);
+    }
+
+    instructions.swap(fused);
+} // end fuseSuperinstructions
+
+double RegisterProgram::evaluate(const CompiledExpression::VariableArray& variableValues) const
+{
+    if (registerCount <= INLINE_REGISTER_CAPACITY)
+    {
+        double registers[INLINE_REGISTER_CAPACITY];
+        return evaluate(variableValues, registers);
+    }
+
+    std::vector<double> registers(registerCount);
+    return evaluate(variableValues, registers.data());
+} // end evaluate
+
+REGISTER_PROGRAM_NO_CONTRACT
+double RegisterProgram::evaluate(const CompiledExpression::VariableArray& variableValues, double* registers) const
+{
+    REGISTER_PROGRAM_CONTRACT_OFF
+
+    for (size_t i = 0; i < CompiledExpression::VARIABLE_CAPACITY; ++i)
+    {
+        registers[i] = variableValues[i];
+    }
+
+    const RegisterInstruction* instruction = instructions.data();
+    double* r = registers;
+
+#if defined(__GNUC__)
+    // Threaded dispatch: each handler jumps straight to the handler of the next instruction
+    static const void* const handlers[] =
+    {
+        &&handleAdd, &&handleSubtract, &&handleMultiply, &&handleDivide,
+        &&handleMultiplyAdd, &&handleMultiplySubtract, &&handleSubtractMultiply, &&handleReturn
+    };
+#define REGISTER_PROGRAM_DISPATCH() goto *handlers[static_cast<size_t>(instruction->opcode)]
+#define REGISTER_PROGRAM_NEXT() ++instruction; REGISTER_PROGRAM_DISPATCH()
+
+    REGISTER_PROGRAM_DISPATCH();
+
+handleAdd:
+    r[instruction->destination] = r[instruction->source1] + r[instruction->source2];
+    REGISTER_PROGRAM_NEXT();
+handleSubtract:
+    r[instruction->destination] = r[instruction->source1] - r[instruction->source2];
+    REGISTER_PROGRAM_NEXT();
+handleMultiply:
+    r[instruction->destination] = r[instruction->source1] * r[instruction->source2];
+    REGISTER_PROGRAM_NEXT();
+handleDivide:
+    if (r[instruction->source2] == 0) throw std::runtime_error("Division by zero");
+    r[instruction->destination] = r[instruction->source1] / r[instruction->source2];
+    REGISTER_PROGRAM_NEXT();
+handleMultiplyAdd:
+    {
+        double product = r[instruction->source1] * r[instruction->source2];
+        r[instruction->destination] = product + r[instruction->source3];
+    }
+    REGISTER_PROGRAM_NEXT();
+handleMultiplySubtract:
+    {
+        double product = r[instruction->source1] * r[instruction->source2];
+        r[instruction->destination] = product - r[instruction->source3];
+    }
+    REGISTER_PROGRAM_NEXT();
+handleSubtractMultiply:
+    {
+        double product = r[instruction->source1] * r[instruction->source2];
+        r[instruction->destination] = r[instruction->source3] - product;
+    }
+    REGISTER_PROGRAM_NEXT();
+handleReturn:
+    return r[instruction->destination];
+
+#undef REGISTER_PROGRAM_NEXT
+#undef REGISTER_PROGRAM_DISPATCH
+#else
+    for (;; ++instruction)
+    {
+        switch (instruction->opcode)
+        {
+        case RegisterOpcode::Add:
+            r[instruction->destination] = r[instruction->source1] + r[instruction->source2];
+            break;
+        case RegisterOpcode::Subtract:
+            r[instruction->destination] = r[instruction->source1] - r[instruction->source2];
+            break;
+        case RegisterOpcode::Multiply:
+            r[instruction->destination] = r[instruction->source1] * r[instruction->source2];
+            break;
+        case RegisterOpcode::Divide:
+            if (r[instruction->source2] == 0) throw std::runtime_error("Division by zero");
+            r[instruction->destination] = r[instruction->source1] / r[instruction->source2];
+            break;
+        case RegisterOpcode::MultiplyAdd:
+        {
+            double product = r[instruction->source1] * r[instruction->source2];
+            r[instruction->destination] = product + r[instruction->source3];
+            break;
+        }
+        case RegisterOpcode::MultiplySubtract:
+        {
+            double product = r[instruction->source1] * r[instruction->source2];
+            r[instruction->destination] = product - r[instruction->source3];
+            break;
+        }
+        case RegisterOpcode::SubtractMultiply:
+        {
+            double product = r[instruction->source1] * r[instruction->source2];
+            r[instruction->destination] = r[instruction->source3] - product;
+            break;
+        }
+        case RegisterOpcode::Return:
+            return r[instruction->destination];
+        }
+    }
+#endif
+} // end evaluate
+
+const std::vector<RegisterProgram::RegisterInstruction>& RegisterProgram::getInstructions() const noexcept
+{
+    return instructions;
+} // end getInstructions
+
+size_t RegisterProgram::getRegisterCount() const noexcept
+{
+    return registerCount;
+} // end getRegisterCount
+
+size_t RegisterProgram::getFusedInstructionCount() const noexcept
+{
+    return fusedInstructionCount;
+} // end getFusedInstructionCount
+
+#undef REGISTER_PROGRAM_NO_CONTRACT
+#undef REGISTER_PROGRAM_CONTRACT_OFF
@@ -0,0 +1,97 @@
+/** @file RegisterProgram.h
+ * @class RegisterProgram
+ * Register-based form of a compiled expression. The register file holds variables a-f in registers 0-5 followed by one register per operand stack slot, so variable loads disappear into instruction operands and every operator becomes one three-address instruction. A multiply feeding straight into an add or subtract is fused into a single superinstruction. Instructions are dispatched with computed goto where the compiler supports it, and with a switch otherwise.
+ */
+
+#ifndef REGISTER_PROGRAM_
+#define REGISTER_PROGRAM_
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "CompiledExpression.h"
+
+class RegisterProgram
+{
+public:
+    /** Register instructions. d, x, y and z name registers. */
+    enum class RegisterOpcode : std::uint8_t
+    {
+        Add,               // d = x + y
+        Subtract,          // d = x - y
+        Multiply,          // d = x * y
+        Divide,            // d = x / y
+        MultiplyAdd,       // d = x * y + z
+        MultiplySubtract,  // d = x * y - z
+        SubtractMultiply,  // d = z - x * y
+        Return             // Result is in d
+    };
+
+    /** One three-address instruction. */
+    struct RegisterInstruction
+    {
+        RegisterOpcode opcode;
+        std::uint16_t destination;
+        std::uint16_t source1;
+        std::uint16_t source2;
+        std::uint16_t source3;
+    };
+
+    /** Register file size that is kept on the call stack. Larger programs use a heap buffer. */
+    static constexpr size_t INLINE_REGISTER_CAPACITY = 64;
+
+private:
+    /** The instruction stream, always ending with Return. */
+    std::vector<RegisterInstruction> instructions;
+
+    /** Number of registers, variables included. */
+    size_t registerCount;
+
+    /** Number of superinstructions produced by fusing a multiply with an add or subtract. */
+    size_t fusedInstructionCount;
+
+    /** Helper function to fuse a multiply with the add or subtract that consumes it.
+     * @pre None
+     * @post Each fusable pair is replaced by one superinstruction. */
+    void fuseSuperinstructions();
+
+public:
+    /** Compiles the bytecode of a compiled expression into register instructions.
+     * @pre None
+     * @post The program computes the same results as evaluatePostfixExpression.
+     * @param expression The compiled expression to lower.
+     * @throws std::length_error If the expression needs more registers than an instruction can name. */
+    explicit RegisterProgram(const CompiledExpression& expression);
+
+    /** Evaluates the program.
+     * @pre None
+     * @post The program is unchanged.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression::VariableArray& variableValues) const;
+
+    /** Evaluates the program using a caller-provided register file, so repeated calls do not allocate.
+     * @pre registers has room for getRegisterCount() values.
+     * @post The contents of registers are overwritten.
+     * @param variableValues The values of variables a-f.
+     * @param registers Scratch space for the register file.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(const CompiledExpression::VariableArray& variableValues, double* registers) const;
+
+    /** Retrieves the instruction stream.
+     * @return The instructions, ending with Return. */
+    const std::vector<RegisterInstruction>& getInstructions() const noexcept;
+
+    /** Retrieves the size of the register file.
+     * @return The number of registers, variables included. */
+    size_t getRegisterCount() const noexcept;
+
+    /** Retrieves the number of superinstructions.
+     * @return The number of fused multiply-add and multiply-subtract instructions. */
+    size_t getFusedInstructionCount() const noexcept;
+};
+
+#include "RegisterProgram.cpp"
+#endif
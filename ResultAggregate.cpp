@@ -0,0 +1,136 @@
+/** @file ResultAggregate.cpp
+ * ResultAggregate keeps count, sum, extremes, division by zero count and a bucket histogram of evaluation results.
+ * @class ResultAggregate
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ResultAggregate.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+ResultAggregate::ResultAggregate(std::vector<double> bounds)
+    : bucketBounds(std::move(bounds)), bucketCounts(bucketBounds.size() + 1, 0), count(0), divisionByZeroCount(0),
+    sum(0), minimum(std::numeric_limits<double>::infinity()), maximum(-std::numeric_limits<double>::infinity())
+{
+    if (std::adjacent_find(bucketBounds.begin(), bucketBounds.end(), std::greater_equal<double>()) != bucketBounds.end())
+    {
+        throw std::invalid_argument("Bucket bounds must be strictly ascending");
+    }
+} // end constructor
+
+void ResultAggregate::record(double value) noexcept
+{
+    ++count;
+    sum += value;
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+    ++bucketCounts[std::upper_bound(bucketBounds.begin(), bucketBounds.end(), value) - bucketBounds.begin()];
+} // end record
+
+void ResultAggregate::record(const double* values, size_t valueCount) noexcept
+{
+    // Keep the running values in locals so the loop does not store them back on every value
+    double runningSum = sum;
+    double runningMinimum = minimum;
+    double runningMaximum = maximum;
+    for (size_t i = 0; i < valueCount; ++i)
+    {
+        runningSum += values[i];
+        runningMinimum = std::min(runningMinimum, values[i]);
+        runningMaximum = std::max(runningMaximum, values[i]);
+    }
+    sum = runningSum;
+    minimum = runningMinimum;
+    maximum = runningMaximum;
+    count += valueCount;
+
+    if (bucketBounds.empty())
+    {
+        bucketCounts[0] += valueCount;
+        return;
+    }
+    for (size_t i = 0; i < valueCount; ++i)
+    {
+        ++bucketCounts[std::upper_bound(bucketBounds.begin(), bucketBounds.end(), values[i]) - bucketBounds.begin()];
+    }
+} // end record
+
+void ResultAggregate::recordDivisionByZero(std::uint64_t rowCount) noexcept
+{
+    divisionByZeroCount += rowCount;
+} // end recordDivisionByZero
+
+void ResultAggregate::merge(const ResultAggregate& other)
+{
+    if (other.bucketBounds != bucketBounds)
+    {
+        throw std::invalid_argument("Cannot merge aggregates with different bucket bounds");
+    }
+    count += other.count;
+    divisionByZeroCount += other.divisionByZeroCount;
+    sum += other.sum;
+    minimum = std::min(minimum, other.minimum);
+    maximum = std::max(maximum, other.maximum);
+    for (size_t i = 0; i < bucketCounts.size(); ++i)
+    {
+        bucketCounts[i] += other.bucketCounts[i];
+    }
+} // end merge
+
+void ResultAggregate::replaceSum(double orderedSum) noexcept
+{
+    sum = orderedSum;
+} // end replaceSum
+
+void ResultAggregate::reset() noexcept
+{
+    std::fill(bucketCounts.begin(), bucketCounts.end(), 0);
+    count = 0;
+    divisionByZeroCount = 0;
+    sum = 0;
+    minimum = std::numeric_limits<double>::infinity();
+    maximum = -std::numeric_limits<double>::infinity();
+} // end reset
+
+std::uint64_t ResultAggregate::getCount() const noexcept
+{
+    return count;
+} // end getCount
+
+std::uint64_t ResultAggregate::getDivisionByZeroCount() const noexcept
+{
+    return divisionByZeroCount;
+} // end getDivisionByZeroCount
+
+double ResultAggregate::getSum() const noexcept
+{
+    return sum;
+} // end getSum
+
+double ResultAggregate::getMean() const noexcept
+{
+    return count == 0 ? 0 : sum / static_cast<double>(count);
+} // end getMean
+
+double ResultAggregate::getMin() const noexcept
+{
+    return count == 0 ? 0 : minimum;
+} // end getMin
+
+double ResultAggregate::getMax() const noexcept
+{
+    return count == 0 ? 0 : maximum;
+} // end getMax
+
+const std::vector<double>& ResultAggregate::getBucketBounds() const noexcept
+{
+    return bucketBounds;
+} // end getBucketBounds
+
+const std::vector<std::uint64_t>& ResultAggregate::getBucketCounts() const noexcept
+{
+    return bucketCounts;
+} // end getBucketCounts
@@ -0,0 +1,117 @@
+/** @file ResultAggregate.h
+ * @class ResultAggregate
+ * Running aggregates of evaluation results: count, sum, mean, minimum, maximum, the number of rows that divided by zero, and counts per histogram bucket. Aggregates of separate parts of a batch are combined with merge.
+ * Bucket i counts values v with bucketBounds[i - 1] <= v < bucketBounds[i], where the first bucket has no lower bound and the last has no upper bound.
+ */
+
+#ifndef RESULT_AGGREGATE_
+#define RESULT_AGGREGATE_
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+class ResultAggregate
+{
+private:
+    /** Ascending upper bounds of every bucket but the last. */
+    std::vector<double> bucketBounds;
+
+    /** Number of values per bucket, one more than there are bounds. */
+    std::vector<std::uint64_t> bucketCounts;
+
+    /** Number of values recorded. */
+    std::uint64_t count;
+
+    /** Number of rows that divided by zero. */
+    std::uint64_t divisionByZeroCount;
+
+    /** Sum of the values, added in the order they were recorded. */
+    double sum;
+
+    /** Smallest value recorded. */
+    double minimum;
+
+    /** Largest value recorded. */
+    double maximum;
+
+public:
+    /** Creates an empty aggregate.
+     * @pre None
+     * @post Nothing is recorded.
+     * @param bounds Ascending bucket bounds. With no bounds every value falls in one bucket.
+     * @throw std::invalid_argument If the bounds are not strictly ascending. */
+    explicit ResultAggregate(std::vector<double> bounds = {});
+
+    /** Records one result.
+     * @pre None
+     * @post The value is counted in every aggregate.
+     * @param value The result to record. */
+    void record(double value) noexcept;
+
+    /** Records results in order.
+     * @pre values holds valueCount results.
+     * @post Each value is counted in every aggregate.
+     * @param values The results to record.
+     * @param valueCount The number of results. */
+    void record(const double* values, size_t valueCount) noexcept;
+
+    /** Records rows that divided by zero.
+     * @pre None
+     * @post The division by zero count grows by rowCount.
+     * @param rowCount The number of rows. */
+    void recordDivisionByZero(std::uint64_t rowCount = 1) noexcept;
+
+    /** Adds the aggregates of another part of the batch, as if its values were recorded after these.
+     * @pre None
+     * @post Every aggregate covers both parts.
+     * @param other The aggregate to add.
+     * @throw std::invalid_argument If the bucket bounds differ. */
+    void merge(const ResultAggregate& other);
+
+    /** Replaces the sum with the same values added in another order, such as the order of their rows when parts were recorded out of order.
+     * @pre orderedSum is a sum of exactly the recorded values.
+     * @post getSum returns orderedSum.
+     * @param orderedSum The sum to keep. */
+    void replaceSum(double orderedSum) noexcept;
+
+    /** Clears every aggregate, keeping the bucket bounds.
+     * @pre None
+     * @post Nothing is recorded. */
+    void reset() noexcept;
+
+    /** Retrieves the number of results recorded.
+     * @return The count, not including rows that divided by zero. */
+    std::uint64_t getCount() const noexcept;
+
+    /** Retrieves the number of rows that divided by zero.
+     * @return The division by zero count. */
+    std::uint64_t getDivisionByZeroCount() const noexcept;
+
+    /** Retrieves the sum of the results.
+     * @return The sum, or 0 if nothing is recorded. */
+    double getSum() const noexcept;
+
+    /** Retrieves the mean of the results.
+     * @return The mean, or 0 if nothing is recorded. */
+    double getMean() const noexcept;
+
+    /** Retrieves the smallest result.
+     * @return The minimum, or 0 if nothing is recorded. */
+    double getMin() const noexcept;
+
+    /** Retrieves the largest result.
+     * @return The maximum, or 0 if nothing is recorded. */
+    double getMax() const noexcept;
+
+    /** Retrieves the bucket bounds.
+     * @return The ascending bounds given at construction. */
+    const std::vector<double>& getBucketBounds() const noexcept;
+
+    /** Retrieves the number of results per bucket.
+     * @return One count per bucket, one more than there are bounds. */
+    const std::vector<std::uint64_t>& getBucketCounts() const noexcept;
+};
+
+#include "ResultAggregate.cpp"
+#endif
@@ -0,0 +1,153 @@
+/** @file ResultMemo.cpp
+ * ResultMemo memoizes evaluation results in a fixed pool of slots evicted with the CLOCK policy.
+ * @class ResultMemo
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ResultMemo.h"
+
+ResultMemo::ResultMemo(size_t capacity)
+    : clockHand(0), hitCount(0), missCount(0), evictionCount(0)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Memo capacity must be at least 1");
+    }
+    slots.resize(capacity, MemoSlot{ 0, 0, {}, 0, false, false });
+    slotLookup.reserve(capacity);
+} // end constructor
+
+size_t ResultMemo::addExpression(const CompiledExpression& expression)
+{
+    expressions.push_back(expression);
+    return expressions.size() - 1;
+} // end addExpression
+
+std::uint64_t ResultMemo::makeKey(size_t expressionId, const CompiledExpression::VariableArray& values,
+    CompiledExpression::VariableArray& keyValues) const noexcept
+{
+    std::uint8_t referenced = expressions[expressionId].getReferencedVariables();
+
+    // 64-bit FNV-1a over the id and the referenced values
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](std::uint32_t word)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                hash ^= (word >> shift) & 0xFF;
+                hash *= 1099511628211ull;
+            }
+        };
+
+    mix(static_cast<std::uint32_t>(expressionId));
+    for (size_t i = 0; i < CompiledExpression::VARIABLE_CAPACITY; ++i)
+    {
+        keyValues[i] = (referenced >> i) & 1 ? values[i] : 0;
+        mix(static_cast<std::uint32_t>(keyValues[i]));
+    }
+    return hash;
+} // end makeKey
+
+size_t ResultMemo::claimSlot()
+{
+    // Sweep until a free slot or one not hit since the last pass, giving referenced slots a second chance
+    while (true)
+    {
+        MemoSlot& slot = slots[clockHand];
+        size_t candidate = clockHand;
+        clockHand = (clockHand + 1) % slots.size();
+
+        if (!slot.occupied)
+        {
+            return candidate;
+        }
+        if (slot.referenced)
+        {
+            slot.referenced = false;
+            continue;
+        }
+
+        slotLookup.erase(slot.keyHash);
+        slot.occupied = false;
+        ++evictionCount;
+        return candidate;
+    }
+} // end claimSlot
+
+double ResultMemo::evaluate(size_t expressionId, const CompiledExpression::VariableArray& values)
+{
+    if (expressionId >= expressions.size())
+    {
+        throw std::out_of_range("Unknown memo expression id");
+    }
+
+    CompiledExpression::VariableArray keyValues;
+    std::uint64_t keyHash = makeKey(expressionId, values, keyValues);
+
+    auto found = slotLookup.find(keyHash);
+    if (found != slotLookup.end())
+    {
+        MemoSlot& slot = slots[found->second];
+        if (slot.expressionId == expressionId && slot.keyValues == keyValues)
+        {
+            slot.referenced = true;
+            ++hitCount;
+            return slot.result;
+        }
+
+        // A different key with the same hash, the new result replaces it
+        slotLookup.erase(found);
+        slot.occupied = false;
+    }
+
+    ++missCount;
+    context.setVariableValues(values);
+    double result = context.evaluate(expressions[expressionId]);
+
+    size_t slotIndex = claimSlot();
+    slots[slotIndex] = MemoSlot{ keyHash, static_cast<std::uint32_t>(expressionId), keyValues, result, false, true };
+    slotLookup.emplace(keyHash, slotIndex);
+    return result;
+} // end evaluate
+
+void ResultMemo::clear() noexcept
+{
+    for (MemoSlot& slot : slots)
+    {
+        slot.occupied = false;
+        slot.referenced = false;
+    }
+    slotLookup.clear();
+    clockHand = 0;
+    hitCount = 0;
+    missCount = 0;
+    evictionCount = 0;
+} // end clear
+
+std::uint64_t ResultMemo::getHitCount() const noexcept
+{
+    return hitCount;
+} // end getHitCount
+
+std::uint64_t ResultMemo::getMissCount() const noexcept
+{
+    return missCount;
+} // end getMissCount
+
+std::uint64_t ResultMemo::getEvictionCount() const noexcept
+{
+    return evictionCount;
+} // end getEvictionCount
+
+double ResultMemo::getHitRate() const noexcept
+{
+    std::uint64_t lookups = hitCount + missCount;
+    return lookups == 0 ? 0 : static_cast<double>(hitCount) / lookups;
+} // end getHitRate
+
+size_t ResultMemo::getSize() const noexcept
+{
+    return slotLookup.size();
+} // end getSize
@@ -0,0 +1,130 @@
+/** @file ResultMemo.h
+ * @class ResultMemo
+ * Bounded memo table for evaluation results. Each registered expression gets an id, and results are keyed by that id plus the values of only the variables the expression references, so rows that differ in unused variables share an entry. When the table is full the CLOCK policy evicts an entry that has not been hit since the hand last passed it. Hit, miss and eviction counters show whether memoization pays off for a workload. A memo is not thread-safe; give each thread its own.
+ */
+
+#ifndef RESULT_MEMO_
+#define RESULT_MEMO_
+
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "CompiledExpression.h"
+#include "EvaluationContext.h"
+
+class ResultMemo
+{
+private:
+    /** One cached result. */
+    struct MemoSlot
+    {
+        /** Hash of the key, used to find the slot in slotLookup. */
+        std::uint64_t keyHash;
+
+        /** Id of the expression the result belongs to. */
+        std::uint32_t expressionId;
+
+        /** Variable values with unreferenced variables set to 0. */
+        CompiledExpression::VariableArray keyValues;
+
+        /** The memoized result. */
+        double result;
+
+        /** Set on every hit and cleared when the clock hand passes. */
+        bool referenced;
+
+        /** True once the slot holds a result. */
+        bool occupied;
+    };
+
+    /** Registered expressions, indexed by id. */
+    std::vector<CompiledExpression> expressions;
+
+    /** Fixed pool of slots the clock hand sweeps. */
+    std::vector<MemoSlot> slots;
+
+    /** Maps a key hash to its slot index. */
+    std::unordered_map<std::uint64_t, size_t> slotLookup;
+
+    /** Next slot the clock hand examines. */
+    size_t clockHand;
+
+    /** Scratch space used to evaluate on a miss. */
+    EvaluationContext context;
+
+    /** Lookups that found a result. */
+    std::uint64_t hitCount;
+
+    /** Lookups that had to evaluate. */
+    std::uint64_t missCount;
+
+    /** Results evicted to make room. */
+    std::uint64_t evictionCount;
+
+    /** Helper function to build the key of an expression and a variable row.
+     * @pre expressionId is registered.
+     * @post keyValues holds values with unreferenced variables set to 0.
+     * @return The hash of the key. */
+    std::uint64_t makeKey(size_t expressionId, const CompiledExpression::VariableArray& values,
+        CompiledExpression::VariableArray& keyValues) const noexcept;
+
+    /** Helper function to pick the slot to fill, evicting with the CLOCK policy when every slot is occupied.
+     * @pre None
+     * @post The returned slot is free and no longer in slotLookup.
+     * @return The slot index. */
+    size_t claimSlot();
+
+public:
+    /** Creates an empty memo.
+     * @pre None
+     * @post The memo can hold capacity results.
+     * @param capacity The most results kept at once.
+     * @throws std::invalid_argument If capacity is 0. */
+    explicit ResultMemo(size_t capacity);
+
+    /** Registers an expression so its results can be memoized.
+     * @pre None
+     * @post The memo keeps a copy of the expression.
+     * @param expression The compiled expression.
+     * @return The id used to evaluate the expression through the memo. */
+    size_t addExpression(const CompiledExpression& expression);
+
+    /** Evaluates a registered expression, returning the memoized result when the same referenced variable values were seen before.
+     * @pre None
+     * @post On a miss the result is memoized, possibly evicting another one. Failed evaluations are not memoized.
+     * @param expressionId The id returned by addExpression.
+     * @param values The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::out_of_range If expressionId is not registered.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(size_t expressionId, const CompiledExpression::VariableArray& values);
+
+    /** Removes every memoized result and resets the counters.
+     * @pre None
+     * @post Registered expressions are kept. */
+    void clear() noexcept;
+
+    /** Retrieves the number of lookups that found a result.
+     * @return The hit count. */
+    std::uint64_t getHitCount() const noexcept;
+
+    /** Retrieves the number of lookups that had to evaluate.
+     * @return The miss count. */
+    std::uint64_t getMissCount() const noexcept;
+
+    /** Retrieves the number of results evicted to make room.
+     * @return The eviction count. */
+    std::uint64_t getEvictionCount() const noexcept;
+
+    /** Retrieves the fraction of lookups that were hits.
+     * @return Hits divided by lookups, or 0 before the first lookup. */
+    double getHitRate() const noexcept;
+
+    /** Retrieves the number of results currently memoized.
+     * @return The number of occupied slots. */
+    size_t getSize() const noexcept;
+};
+
+#include "ResultMemo.cpp"
+#endif
@@ -0,0 +1,192 @@
+/** @file ResultWriter.cpp
+ * ResultWriter formats results with std::to_chars into a large buffer and writes it with few system calls.
+ * @class ResultWriter
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "ResultWriter.h"
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+ResultWriter::ResultWriter(const std::string& filename, size_t bufferSize)
+    : ResultWriter(-1, bufferSize)
+{
+#ifdef _WIN32
+    fileDescriptor = _open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    fileDescriptor = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Could not create results file " + filename);
+    }
+    ownsDescriptor = true;
+} // end constructor
+
+ResultWriter::ResultWriter(int descriptor, size_t bufferSize)
+    : fileDescriptor(descriptor), ownsDescriptor(false),
+    buffer(std::max(bufferSize, MAX_VALUE_CHARS * 4)), bufferedBytes(0), bytesWritten(0)
+{ } // end constructor
+
+ResultWriter::~ResultWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (const std::runtime_error&)
+    {
+        // Nothing can be reported from a destructor
+    }
+    if (ownsDescriptor)
+    {
+#ifdef _WIN32
+        _close(fileDescriptor);
+#else
+        close(fileDescriptor);
+#endif
+    }
+} // end destructor
+
+void ResultWriter::writeAll(const char* data, size_t length)
+{
+    size_t offset = 0;
+    while (offset < length)
+    {
+#ifdef _WIN32
+        int written = _write(fileDescriptor, data + offset, static_cast<unsigned int>(std::min<size_t>(length - offset, 1u << 30)));
+#else
+        ssize_t written = write(fileDescriptor, data + offset, length - offset);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Could not write results");
+        }
+        offset += static_cast<size_t>(written);
+        bytesWritten += static_cast<std::uint64_t>(written);
+    }
+} // end writeAll
+
+void ResultWriter::flush()
+{
+    size_t length = bufferedBytes;
+    bufferedBytes = 0;  // Dropped even if writing fails, so a failed flush is not repeated with stale bytes
+    writeAll(buffer.data(), length);
+} // end flush
+
+void ResultWriter::reserve(size_t byteCount)
+{
+    if (buffer.size() - bufferedBytes < byteCount)
+    {
+        flush();
+    }
+} // end reserve
+
+void ResultWriter::appendValue(double value) noexcept
+{
+    char* end = buffer.data() + buffer.size();
+    std::to_chars_result formatted = std::to_chars(buffer.data() + bufferedBytes, end, value);
+    bufferedBytes = static_cast<size_t>(formatted.ptr - buffer.data());
+} // end appendValue
+
+void ResultWriter::writeCsvHeader(const std::vector<std::string>& columnNames)
+{
+    for (size_t i = 0; i < columnNames.size(); ++i)
+    {
+        const std::string& name = columnNames[i];
+        size_t offset = 0;
+        do
+        {
+            // Names longer than the buffer are copied across several flushes
+            reserve(2);
+            size_t length = std::min(name.size() - offset, buffer.size() - bufferedBytes - 1);
+            std::memcpy(buffer.data() + bufferedBytes, name.data() + offset, length);
+            bufferedBytes += length;
+            offset += length;
+        } while (offset < name.size());
+        buffer[bufferedBytes++] = i + 1 < columnNames.size() ? ',' : '\n';
+    }
+} // end writeCsvHeader
+
+void ResultWriter::writeCsv(const double* results, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        reserve(MAX_VALUE_CHARS + 1);
+        appendValue(results[i]);
+        buffer[bufferedBytes++] = '\n';
+    }
+} // end writeCsv
+
+void ResultWriter::writeCsvRows(const double* const* columns, size_t columnCount, size_t rowCount)
+{
+    for (size_t row = 0; row < rowCount; ++row)
+    {
+        for (size_t column = 0; column < columnCount; ++column)
+        {
+            reserve(MAX_VALUE_CHARS + 1);
+            appendValue(columns[column][row]);
+            buffer[bufferedBytes++] = column + 1 < columnCount ? ',' : '\n';
+        }
+    }
+} // end writeCsvRows
+
+void ResultWriter::writeBinaryColumn(const double* results, size_t count)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        // A column at least as large as the buffer is already in its final byte order, so write it in place
+        if (count * sizeof(double) >= buffer.size())
+        {
+            flush();
+            writeAll(reinterpret_cast<const char*>(results), count * sizeof(double));
+            return;
+        }
+    }
+
+    size_t offset = 0;
+    while (offset < count)
+    {
+        reserve(sizeof(double));
+        size_t batch = std::min(count - offset, (buffer.size() - bufferedBytes) / sizeof(double));
+        char* destination = buffer.data() + bufferedBytes;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(destination, results + offset, batch * sizeof(double));
+        }
+        else
+        {
+            for (size_t i = 0; i < batch; ++i)
+            {
+                std::uint64_t bits = std::bit_cast<std::uint64_t>(results[offset + i]);
+                for (size_t byte = 0; byte < sizeof(bits); ++byte)
+                {
+                    destination[i * sizeof(bits) + byte] = static_cast<char>(bits >> (8 * byte));
+                }
+            }
+        }
+        bufferedBytes += batch * sizeof(double);
+        offset += batch;
+    }
+} // end writeBinaryColumn
+
+std::uint64_t ResultWriter::getBytesWritten() const noexcept
+{
+    return bytesWritten;
+} // end getBytesWritten
@@ -0,0 +1,129 @@
+/** @file ResultWriter.h
+ * @class ResultWriter
+ * Writes large arrays of evaluation results to a file, as CSV text or as raw little-endian binary columns. Values are formatted with std::to_chars straight into one large reusable buffer, which is handed to the operating system with a single write call whenever it fills up, so neither iostreams nor per-value allocations are involved.
+ * CSV values use the shortest form that reads back to the same double. Binary columns are the 8 bytes of each IEEE double in little-endian order, one column after another.
+ */
+
+#ifndef RESULT_WRITER_
+#define RESULT_WRITER_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class ResultWriter
+{
+public:
+    /** Default size of the output buffer in bytes. */
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+    /** Longest text std::to_chars produces for a double in shortest form. */
+    static constexpr size_t MAX_VALUE_CHARS = 32;
+
+private:
+    /** File descriptor written to. */
+    int fileDescriptor;
+
+    /** Whether the descriptor was opened by this writer and must be closed. */
+    bool ownsDescriptor;
+
+    /** Formatted bytes waiting to be written. */
+    std::vector<char> buffer;
+
+    /** Number of bytes of buffer in use. */
+    size_t bufferedBytes;
+
+    /** Number of bytes handed to the operating system so far. */
+    std::uint64_t bytesWritten;
+
+    /** Helper function to hand bytes to the operating system, repeating partial writes.
+     * @pre None
+     * @post Every byte has been written.
+     * @throw std::runtime_error If writing fails. */
+    void writeAll(const char* data, size_t length);
+
+    /** Helper function to make room for at least byteCount more bytes, flushing if needed.
+     * @pre byteCount <= buffer.size()
+     * @throw std::runtime_error If writing fails. */
+    void reserve(size_t byteCount);
+
+    /** Helper function to format one value at the end of the buffer.
+     * @pre At least MAX_VALUE_CHARS bytes are free. */
+    void appendValue(double value) noexcept;
+
+public:
+    /** Creates or truncates a file and writes to it.
+     * @pre None
+     * @post The file is open and empty.
+     * @param filename The name of the file to write.
+     * @param bufferSize Size of the output buffer in bytes, at least MAX_VALUE_CHARS * 4.
+     * @throw std::runtime_error If the file cannot be created. */
+    explicit ResultWriter(const std::string& filename, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /** Writes to an already open file descriptor, which is left open.
+     * @pre descriptor is open for writing.
+     * @post None
+     * @param descriptor The file descriptor to write to.
+     * @param bufferSize Size of the output buffer in bytes, at least MAX_VALUE_CHARS * 4. */
+    explicit ResultWriter(int descriptor, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /** Writers cannot be copied. */
+    ResultWriter(const ResultWriter&) = delete;
+
+    /** Writers cannot be copied. */
+    ResultWriter& operator=(const ResultWriter&) = delete;
+
+    /** Destructor writes anything still buffered and closes a file the writer opened. Errors are ignored here, call flush first to see them.
+     * @pre None
+     * @post Buffered bytes have been written. */
+    ~ResultWriter();
+
+    /** Writes a CSV header line.
+     * @pre None
+     * @post The names, separated by commas, and a newline are buffered.
+     * @param columnNames The name of each column.
+     * @throw std::runtime_error If writing fails. */
+    void writeCsvHeader(const std::vector<std::string>& columnNames);
+
+    /** Writes results as CSV with one value per line.
+     * @pre results holds count values.
+     * @post count lines are buffered.
+     * @param results The values to write.
+     * @param count The number of values.
+     * @throw std::runtime_error If writing fails. */
+    void writeCsv(const double* results, size_t count);
+
+    /** Writes several result columns as CSV rows, with the values of one row separated by commas.
+     * @pre Each of the columnCount columns holds rowCount values.
+     * @post rowCount lines are buffered.
+     * @param columns One pointer per column.
+     * @param columnCount The number of columns.
+     * @param rowCount The number of rows.
+     * @throw std::runtime_error If writing fails. */
+    void writeCsvRows(const double* const* columns, size_t columnCount, size_t rowCount);
+
+    /** Writes results as a raw little-endian binary column.
+     * @pre results holds count values.
+     * @post 8 * count bytes are buffered or written. Columns at least as large as the buffer are written directly from results.
+     * @param results The values to write.
+     * @param count The number of values.
+     * @throw std::runtime_error If writing fails. */
+    void writeBinaryColumn(const double* results, size_t count);
+
+    /** Writes everything buffered.
+     * @pre None
+     * @post The buffer is empty, even if writing failed.
+     * @throw std::runtime_error If writing fails. */
+    void flush();
+
+    /** Retrieves the number of bytes handed to the operating system so far.
+     * @pre None
+     * @post None
+     * @return The byte count, not including bytes still buffered. */
+    std::uint64_t getBytesWritten() const noexcept;
+};
+
+#include "ResultWriter.cpp"
+#endif
@@ -0,0 +1,227 @@
+/** @file SharedProgramStore.cpp
+ * SharedProgramStore publishes a program image in named shared memory and attaches to it read-only.
+ * @class SharedProgramStore
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "SharedProgramStore.h"
+#include <cstring>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+std::string SharedProgramStore::segmentName(const std::string& name)
+{
+    return "Local\\" + name;
+} // end segmentName
+
+void SharedProgramStore::mapNewSegment(const std::string& name, size_t segmentSize)
+{
+    mappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(static_cast<std::uint64_t>(segmentSize) >> 32), static_cast<DWORD>(segmentSize), segmentName(name).c_str());
+    if (mappingHandle == nullptr || GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+        if (mappingHandle != nullptr)
+        {
+            CloseHandle(mappingHandle);
+        }
+        throw std::runtime_error("Could not create shared program store: " + name);
+    }
+
+    mappedData = MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, segmentSize);
+    if (mappedData == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        throw std::runtime_error("Could not map shared program store: " + name);
+    }
+    mappedSize = segmentSize;
+} // end mapNewSegment
+
+void SharedProgramStore::mapExistingSegment(const std::string& name)
+{
+    mappingHandle = OpenFileMappingA(FILE_MAP_READ, FALSE, segmentName(name).c_str());
+    if (mappingHandle == nullptr)
+    {
+        throw std::runtime_error("Could not open shared program store: " + name);
+    }
+
+    mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (mappedData == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        throw std::runtime_error("Could not map shared program store: " + name);
+    }
+
+    MEMORY_BASIC_INFORMATION region;
+    VirtualQuery(mappedData, &region, sizeof(region));
+    mappedSize = region.RegionSize;
+} // end mapExistingSegment
+
+bool SharedProgramStore::remove(const std::string&) noexcept
+{
+    return false;  // A named mapping disappears when its last handle is closed
+} // end remove
+
+void SharedProgramStore::unmap() noexcept
+{
+    if (mappedData != nullptr)
+    {
+        UnmapViewOfFile(mappedData);
+        CloseHandle(mappingHandle);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+} // end unmap
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::string SharedProgramStore::segmentName(const std::string& name)
+{
+    return "/" + name;
+} // end segmentName
+
+void SharedProgramStore::mapNewSegment(const std::string& name, size_t segmentSize)
+{
+    int fileDescriptor = shm_open(segmentName(name).c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Could not create shared program store: " + name);
+    }
+    if (ftruncate(fileDescriptor, static_cast<off_t>(segmentSize)) != 0)
+    {
+        close(fileDescriptor);
+        shm_unlink(segmentName(name).c_str());
+        throw std::runtime_error("Could not size shared program store: " + name);
+    }
+
+    void* address = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);  // The mapping keeps the segment open
+    if (address == MAP_FAILED)
+    {
+        shm_unlink(segmentName(name).c_str());
+        throw std::runtime_error("Could not map shared program store: " + name);
+    }
+    mappedData = address;
+    mappedSize = segmentSize;
+} // end mapNewSegment
+
+void SharedProgramStore::mapExistingSegment(const std::string& name)
+{
+    int fileDescriptor = shm_open(segmentName(name).c_str(), O_RDONLY, 0);
+    if (fileDescriptor < 0)
+    {
+        throw std::runtime_error("Could not open shared program store: " + name);
+    }
+
+    struct stat segmentStatus;
+    if (fstat(fileDescriptor, &segmentStatus) != 0 || static_cast<size_t>(segmentStatus.st_size) < sizeof(SegmentHeader))
+    {
+        close(fileDescriptor);
+        throw std::runtime_error("Shared program store is not ready: " + name);
+    }
+
+    void* address = mmap(nullptr, static_cast<size_t>(segmentStatus.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (address == MAP_FAILED)
+    {
+        throw std::runtime_error("Could not map shared program store: " + name);
+    }
+    mappedData = address;
+    mappedSize = static_cast<size_t>(segmentStatus.st_size);
+} // end mapExistingSegment
+
+bool SharedProgramStore::remove(const std::string& name) noexcept
+{
+    return shm_unlink(segmentName(name).c_str()) == 0;
+} // end remove
+
+void SharedProgramStore::unmap() noexcept
+{
+    if (mappedData != nullptr)
+    {
+        munmap(mappedData, mappedSize);
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+} // end unmap
+#endif
+
+SharedProgramStore::SharedProgramStore(const std::string& name, const ProgramImageWriter& writer)
+    : mappedData(nullptr), mappedSize(0)
+#ifdef _WIN32
+    , mappingHandle(nullptr)
+#endif
+{
+    std::vector<unsigned char> imageBytes = writer.build();
+    mapNewSegment(name, sizeof(SegmentHeader) + imageBytes.size());
+
+    // Write the image first and flag it ready last, so attaching processes never see it half written
+    unsigned char* segment = static_cast<unsigned char*>(mappedData);
+    SegmentHeader* header = new (segment) SegmentHeader{ { 'P', 'F', 'X', 'S' }, { 0 }, imageBytes.size(), {} };
+    std::memcpy(segment + sizeof(SegmentHeader), imageBytes.data(), imageBytes.size());
+    header->ready.store(1, std::memory_order_release);
+
+    image.emplace(segment + sizeof(SegmentHeader), imageBytes.size());
+} // end constructor
+
+SharedProgramStore::SharedProgramStore(const std::string& name)
+    : mappedData(nullptr), mappedSize(0)
+#ifdef _WIN32
+    , mappingHandle(nullptr)
+#endif
+{
+    mapExistingSegment(name);
+    try
+    {
+        const unsigned char* segment = static_cast<const unsigned char*>(mappedData);
+        const SegmentHeader* header = reinterpret_cast<const SegmentHeader*>(segment);
+        if (mappedSize < sizeof(SegmentHeader) || std::memcmp(header->magic, "PFXS", 4) != 0)
+        {
+            throw std::runtime_error("Not a shared program store: " + name);
+        }
+        if (header->ready.load(std::memory_order_acquire) != 1)
+        {
+            throw std::runtime_error("Shared program store is not ready: " + name);
+        }
+        if (header->imageSize > mappedSize - sizeof(SegmentHeader))
+        {
+            throw std::runtime_error("Shared program store is truncated: " + name);
+        }
+        image.emplace(segment + sizeof(SegmentHeader), static_cast<size_t>(header->imageSize));
+    }
+    catch (...)
+    {
+        unmap();
+        throw;
+    }
+} // end constructor
+
+SharedProgramStore::~SharedProgramStore()
+{
+    unmap();
+} // end destructor
+
+const ProgramImage& SharedProgramStore::getImage() const noexcept
+{
+    return *image;
+} // end getImage
+
+size_t SharedProgramStore::getExpressionCount() const noexcept
+{
+    return image->getExpressionCount();
+} // end getExpressionCount
+
+double SharedProgramStore::evaluate(size_t expressionIndex, const CompiledExpression::VariableArray& variableValues) const
+{
+    return image->evaluate(expressionIndex, variableValues);
+} // end evaluate
@@ -0,0 +1,128 @@
+/** @file SharedProgramStore.h
+ * @class SharedProgramStore
+ * Shares one copy of a compiled formula set between processes. A publishing process writes a ProgramImage into a named shared memory segment (POSIX shm_open, or a named file mapping on Windows), and worker processes attach to it read-only and evaluate in place. The image is offset-based, so it works at whatever address each process maps it, and memory and warm-up cost stay constant as workers are added.
+ *
+ * Segment layout: a 64-byte SegmentHeader holding magic "PFXS", a ready flag and the image size, followed by the image. The ready flag is set with release ordering only after the whole image is written, so an attached process never sees a partial image.
+ */
+
+#ifndef SHARED_PROGRAM_STORE_
+#define SHARED_PROGRAM_STORE_
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include "ProgramImage.h"
+#include "ProgramImageWriter.h"
+
+class SharedProgramStore
+{
+public:
+    /** Fixed-size header at the start of every segment. */
+    struct SegmentHeader
+    {
+        char magic[4];
+        std::atomic<std::uint32_t> ready;
+        std::uint64_t imageSize;
+        unsigned char reserved[48];
+    };
+
+    static_assert(sizeof(SegmentHeader) == 64, "SegmentHeader must match the segment layout");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "The ready flag must be usable across processes");
+
+private:
+    /** Start of the mapped segment. */
+    void* mappedData;
+
+    /** Number of mapped bytes. */
+    size_t mappedSize;
+
+#ifdef _WIN32
+    /** Handle of the named mapping. The segment exists as long as some process holds one. */
+    void* mappingHandle;
+#endif
+
+    /** View over the image inside the segment. */
+    std::optional<ProgramImage> image;
+
+    /** Helper function to turn a store name into a platform segment name.
+     * @param name The store name.
+     * @return The name passed to the operating system. */
+    static std::string segmentName(const std::string& name);
+
+    /** Helper function to create and map a writable segment.
+     * @pre None
+     * @post mappedData points to segmentSize writable bytes.
+     * @param name The store name.
+     * @param segmentSize The number of bytes in the segment.
+     * @throw std::runtime_error If the segment already exists or cannot be created. */
+    void mapNewSegment(const std::string& name, size_t segmentSize);
+
+    /** Helper function to map an existing segment read-only.
+     * @pre None
+     * @post mappedData points to the whole segment.
+     * @param name The store name.
+     * @throw std::runtime_error If the segment does not exist or cannot be mapped. */
+    void mapExistingSegment(const std::string& name);
+
+    /** Helper function to release the mapping.
+     * @pre None
+     * @post Nothing is mapped. */
+    void unmap() noexcept;
+
+public:
+    /** Creates a segment and publishes a formula set in it.
+     * @pre No segment with this name exists.
+     * @post The segment holds the image and is marked ready. This process keeps its view of the segment.
+     * @param name The store name, shared by every process.
+     * @param writer The compiled formulas to publish.
+     * @throw std::runtime_error If the segment already exists or cannot be created. */
+    SharedProgramStore(const std::string& name, const ProgramImageWriter& writer);
+
+    /** Attaches read-only to a published segment.
+     * @pre None
+     * @post The segment is mapped read-only and its image validated.
+     * @param name The store name used by the publishing process.
+     * @throw std::runtime_error If the segment does not exist, is not ready, or does not hold a valid image. */
+    explicit SharedProgramStore(const std::string& name);
+
+    /** Stores own their mapping and cannot be copied. */
+    SharedProgramStore(const SharedProgramStore&) = delete;
+
+    /** Stores own their mapping and cannot be copied. */
+    SharedProgramStore& operator=(const SharedProgramStore&) = delete;
+
+    /** Unmaps the segment. The segment itself stays until remove is called.
+     * @pre None
+     * @post This process no longer maps the segment. */
+    ~SharedProgramStore();
+
+    /** Deletes a segment by name. Processes still attached keep their mapping.
+     * @pre None
+     * @post New processes can no longer attach under the name.
+     * @param name The store name.
+     * @return True if a segment was removed. */
+    static bool remove(const std::string& name) noexcept;
+
+    /** Retrieves the image inside the segment.
+     * @return A view that evaluates expressions in place. */
+    const ProgramImage& getImage() const noexcept;
+
+    /** Retrieves the number of expressions in the store.
+     * @return The number of expressions. */
+    size_t getExpressionCount() const noexcept;
+
+    /** Evaluates an expression in place.
+     * @pre None
+     * @post The store is unchanged.
+     * @param expressionIndex The position of the expression in the store.
+     * @param variableValues The values of variables a-f.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::out_of_range If expressionIndex is not a valid position.
+     * @throws std::runtime_error If division by zero occurs. */
+    double evaluate(size_t expressionIndex, const CompiledExpression::VariableArray& variableValues) const;
+};
+
+#include "SharedProgramStore.cpp"
+#endif
@@ -0,0 +1,36 @@
+/** @file StackReplayBackend.cpp
+ * StackReplayBackend evaluates postfix tokens with a LinkedDeque acting as a stack.
+ * @class StackReplayBackend
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "StackReplayBackend.h"
+
+double StackReplayBackend::execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+    std::pmr::memory_resource* resource) const
+{
+    LinkedDeque<double> evaluationStack(resource);  // Deque to hold intermediate results
+
+    for (char currentChar : expression.getPostfixExpression())
+    {
+        if (std::isalpha(currentChar))  // Operand
+        {
+            evaluationStack.enqueueBack(variableValues[currentChar - 'a']);
+        }
+        else  // Operator, operand count was validated at compile time
+        {
+            double operands[2];  // Popped back first: right operand, then left
+            evaluationStack.popBack(2, operands);
+            evaluationStack.enqueueBack(CompiledExpression::applyOperator(currentChar, operands[1], operands[0]));
+        }
+    }
+
+    return evaluationStack.peekBack();
+} // end execute
+
+std::string StackReplayBackend::getName() const
+{
+    return "stack-replay";
+} // end getName
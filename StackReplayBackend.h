@@ -0,0 +1,33 @@
+/** @file StackReplayBackend.h
+ * @class StackReplayBackend
+ * Execution backend that replays the postfix tokens on a LinkedDeque operand stack, the same way evaluatePostfixExpression does.
+ */
+
+#ifndef STACK_REPLAY_BACKEND_
+#define STACK_REPLAY_BACKEND_
+
+#include <cctype>
+#include "ExecutionBackendInterface.h"
+#include "LinkedDeque.h"
+
+class StackReplayBackend : public ExecutionBackendInterface
+{
+public:
+    /** Evaluates a compiled expression by replaying its postfix tokens.
+     * @pre None
+     * @post The expression and variable values are unchanged.
+     * @param expression The compiled expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @param resource Memory resource the operand stack allocates from.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+        std::pmr::memory_resource* resource) const override;
+
+    /** Retrieves the name of this backend.
+     * @return "stack-replay" */
+    std::string getName() const override;
+};
+
+#include "StackReplayBackend.cpp"
+#endif
@@ -0,0 +1,217 @@
+/** @file StreamingConverter.cpp
+ * StreamingConverter converts infix to postfix chunk by chunk with memory bounded by operator stack depth.
+ * @class StreamingConverter
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "StreamingConverter.h"
+#include <cerrno>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+StreamingConverter::StreamingConverter(Sink outputSink, size_t bytesPerChunk)
+    : sink(std::move(outputSink)), chunkSize(bytesPerChunk == 0 ? 1 : bytesPerChunk),
+    operatorDepth(0), maxOperatorDepth(0), tokensEmitted(0), atExpressionStart(true)
+{
+    outputBuffer.reserve(chunkSize);
+} // end constructor
+
+StreamingConverter::StreamingConverter(std::ostream& output, size_t bytesPerChunk)
+    : StreamingConverter([&output](const char* data, size_t length)
+        {
+            output.write(data, static_cast<std::streamsize>(length));
+        }, bytesPerChunk)
+{ } // end constructor
+
+int StreamingConverter::precedence(char operatorChar) noexcept
+{
+    if (operatorChar == '+' || operatorChar == '-')
+    {
+        return 1;
+    }
+    if (operatorChar == '*' || operatorChar == '/')
+    {
+        return 2;
+    }
+    return 0;
+} // end precedence
+
+void StreamingConverter::emit(char token)
+{
+    outputBuffer += token;
+    ++tokensEmitted;
+    if (outputBuffer.size() >= chunkSize)
+    {
+        flush();
+    }
+} // end emit
+
+void StreamingConverter::emitTopOperator()
+{
+    emit(operatorStack.popBack());
+    --operatorDepth;
+} // end emitTopOperator
+
+void StreamingConverter::flush()
+{
+    if (!outputBuffer.empty())
+    {
+        sink(outputBuffer.data(), outputBuffer.size());
+        outputBuffer.clear();
+    }
+} // end flush
+
+void StreamingConverter::reset() noexcept
+{
+    operatorStack.clear();
+    outputBuffer.clear();
+    operatorDepth = 0;
+    maxOperatorDepth = 0;
+    tokensEmitted = 0;
+    atExpressionStart = true;
+} // end reset
+
+void StreamingConverter::beginExpression() noexcept
+{
+    // The counters of a finished expression stay readable until the next one starts
+    if (atExpressionStart)
+    {
+        maxOperatorDepth = 0;
+        tokensEmitted = 0;
+        atExpressionStart = false;
+    }
+} // end beginExpression
+
+void StreamingConverter::feed(const char* data, size_t length)
+{
+    beginExpression();
+
+    // Same traversal as InfixToPostfixEvaluation::convertInfixToPostfix, one character at a time
+    for (size_t i = 0; i < length; ++i)
+    {
+        char currentChar = static_cast<char>(std::tolower(static_cast<unsigned char>(data[i])));
+
+        if (std::isalpha(static_cast<unsigned char>(currentChar)))
+        {
+            emit(currentChar);
+            continue;
+        }
+
+        switch (currentChar)
+        {
+        case '(':
+            operatorStack.enqueueBack(currentChar);
+            break;
+
+        case '+': case '-': case '*': case '/':
+            while (operatorDepth > 0 && operatorStack.peekBack() != '(' &&
+                precedence(currentChar) <= precedence(operatorStack.peekBack()))
+            {
+                emitTopOperator();
+            }
+            operatorStack.enqueueBack(currentChar);
+            break;
+
+        case ')':
+            while (operatorDepth > 0 && operatorStack.peekBack() != '(')
+            {
+                emitTopOperator();
+            }
+            if (operatorDepth == 0)
+            {
+                reset();
+                throw std::runtime_error("Invalid infix expression");
+            }
+            operatorStack.dequeueBack();  // Remove the open parenthesis
+            --operatorDepth;
+            continue;
+
+        default:
+            continue;  // Whitespace and other characters are skipped
+        }
+
+        // An operator or open parenthesis was pushed
+        if (++operatorDepth > maxOperatorDepth)
+        {
+            maxOperatorDepth = operatorDepth;
+        }
+    }
+} // end feed
+
+void StreamingConverter::finish()
+{
+    beginExpression();
+    while (operatorDepth > 0)
+    {
+        if (operatorStack.peekBack() == '(')
+        {
+            reset();
+            throw std::runtime_error("Invalid infix expression");
+        }
+        emitTopOperator();
+    }
+    flush();
+    atExpressionStart = true;
+} // end finish
+
+void StreamingConverter::convert(std::istream& input)
+{
+    reset();
+
+    std::vector<char> chunk(chunkSize);
+    while (input.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || input.gcount() > 0)
+    {
+        feed(chunk.data(), static_cast<size_t>(input.gcount()));
+    }
+    if (input.bad())
+    {
+        throw std::runtime_error("Could not read infix expression");
+    }
+    finish();
+} // end convert
+
+void StreamingConverter::convert(int fileDescriptor)
+{
+    reset();
+
+    std::vector<char> chunk(chunkSize);
+    while (true)
+    {
+#ifdef _WIN32
+        int bytesRead = _read(fileDescriptor, chunk.data(), static_cast<unsigned int>(chunk.size()));
+#else
+        ssize_t bytesRead = read(fileDescriptor, chunk.data(), chunk.size());
+#endif
+        if (bytesRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Could not read infix expression");
+        }
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        feed(chunk.data(), static_cast<size_t>(bytesRead));
+    }
+    finish();
+} // end convert
+
+size_t StreamingConverter::getMaxOperatorDepth() const noexcept
+{
+    return maxOperatorDepth;
+} // end getMaxOperatorDepth
+
+size_t StreamingConverter::getTokensEmitted() const noexcept
+{
+    return tokensEmitted;
+} // end getTokensEmitted
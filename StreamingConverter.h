@@ -0,0 +1,136 @@
+/** @file StreamingConverter.h
+ * @class StreamingConverter
+ * Converts infix expressions of any length to postfix without holding either one in memory. Input is read in chunks from a std::istream or a file descriptor, and postfix tokens are written in chunks to a sink as soon as they are known. Memory use is bounded by the operator stack depth plus one output chunk, not by the size of the expression.
+ */
+
+#ifndef STREAMING_CONVERTER_
+#define STREAMING_CONVERTER_
+
+#include <cctype>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include "LinkedDeque.h"
+
+class StreamingConverter
+{
+public:
+    /** Receives postfix output. Called with consecutive pieces of the postfix expression. */
+    using Sink = std::function<void(const char* data, size_t length)>;
+
+    /** Default number of bytes read and written per chunk. */
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+private:
+    /** Destination of the postfix output. */
+    Sink sink;
+
+    /** Number of bytes read and written per chunk. */
+    size_t chunkSize;
+
+    /** Operators and open parentheses not yet emitted. */
+    LinkedDeque<char> operatorStack;
+
+    /** Postfix tokens waiting to be passed to the sink. */
+    std::string outputBuffer;
+
+    /** Current number of entries on operatorStack. */
+    size_t operatorDepth;
+
+    /** Deepest operatorStack seen since the last reset. */
+    size_t maxOperatorDepth;
+
+    /** Number of postfix tokens emitted since the last reset. */
+    size_t tokensEmitted;
+
+    /** True when the next feed or finish starts a new expression. */
+    bool atExpressionStart;
+
+    /** Helper function to determine the precedence of an operator.
+     * @pre None
+     * @post None
+     * @param operatorChar The operator character.
+     * @return An integer representing the precedence level. */
+    static int precedence(char operatorChar) noexcept;
+
+    /** Helper function to append one token to the output, flushing when a chunk is full.
+     * @pre None
+     * @post The token is buffered or has been passed to the sink. */
+    void emit(char token);
+
+    /** Helper function to move the top of the operator stack to the output.
+     * @pre operatorStack is not empty.
+     * @post The top operator has been emitted and removed. */
+    void emitTopOperator();
+
+    /** Helper function to pass buffered output to the sink.
+     * @pre None
+     * @post outputBuffer is empty. */
+    void flush();
+
+    /** Helper function to discard a conversion in progress.
+     * @pre None
+     * @post The operator stack and output buffer are empty and the counters are zero. */
+    void reset() noexcept;
+
+    /** Helper function to start counting a new expression after the last one finished.
+     * @pre None
+     * @post If the last expression finished, the counters are zero. */
+    void beginExpression() noexcept;
+
+public:
+    /** Creates a converter writing to a sink.
+     * @pre sink is callable.
+     * @post No conversion is in progress.
+     * @param outputSink Receives the postfix expression in pieces.
+     * @param bytesPerChunk Number of bytes read and written per chunk. */
+    explicit StreamingConverter(Sink outputSink, size_t bytesPerChunk = DEFAULT_CHUNK_SIZE);
+
+    /** Creates a converter writing to a std::ostream.
+     * @pre output stays alive as long as the converter.
+     * @post No conversion is in progress.
+     * @param output Receives the postfix expression.
+     * @param bytesPerChunk Number of bytes read and written per chunk. */
+    explicit StreamingConverter(std::ostream& output, size_t bytesPerChunk = DEFAULT_CHUNK_SIZE);
+
+    /** Converts part of an infix expression. Pieces may split the expression anywhere.
+     * @pre None
+     * @post Every postfix token determined by the input so far has been buffered or emitted.
+     * @param data The next piece of the infix expression.
+     * @param length The number of characters in the piece.
+     * @throws std::runtime_error If a closing parenthesis has no matching opening parenthesis. The rest of the conversion is discarded, but full chunks may already have been passed to the sink. */
+    void feed(const char* data, size_t length);
+
+    /** Ends the expression started by the first feed since the last finish.
+     * @pre None
+     * @post The rest of the postfix expression has been passed to the sink and the converter is ready for the next expression.
+     * @throws std::runtime_error If an opening parenthesis was never closed. The rest of the conversion is discarded, but full chunks may already have been passed to the sink. */
+    void finish();
+
+    /** Converts a whole infix expression read from a stream.
+     * @pre None
+     * @post input has been read to its end. The postfix expression has been passed to the sink.
+     * @param input Source of the infix expression.
+     * @throws std::runtime_error If the parentheses do not match or the stream fails. Part of the postfix expression may already have been passed to the sink. */
+    void convert(std::istream& input);
+
+    /** Converts a whole infix expression read from a file descriptor.
+     * @pre fileDescriptor is open for reading.
+     * @post fileDescriptor has been read to its end and is still open. The postfix expression has been passed to the sink.
+     * @param fileDescriptor Source of the infix expression.
+     * @throws std::runtime_error If the parentheses do not match or reading fails. Part of the postfix expression may already have been passed to the sink. */
+    void convert(int fileDescriptor);
+
+    /** Retrieves the deepest operator stack of the current or last conversion.
+     * @return The largest number of pending operators and parentheses. */
+    size_t getMaxOperatorDepth() const noexcept;
+
+    /** Retrieves the number of postfix tokens emitted by the current or last conversion.
+     * @return The number of tokens. */
+    size_t getTokensEmitted() const noexcept;
+};
+
+#include "StreamingConverter.cpp"
+#endif
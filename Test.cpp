@@ -6,11 +6,65 @@
  */
 
 #include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <iterator>
 #include "InfixToPostfixEvaluation.h"
 #include "LinkedDeque.h"
+#include "PersistentDeque.h"
+#include "ExecutionBackendFactory.h"
+#include "ProgramImageWriter.h"
+#include "MappedFile.h"
+#include "PostfixDiskCache.h"
+#include "ExpressionBatch.h"
+#include "RegisterProgram.h"
+#include "MultiExpressionEvaluator.h"
+#include "AsyncEvaluationService.h"
+#include "StreamingConverter.h"
+#include "VariableStore.h"
+#include "ResultMemo.h"
+#include "BulkConverter.h"
+#include "LatencyHistogram.h"
+#include "JitProgram.h"
+#include "ChainProgram.h"
+#include "SharedProgramStore.h"
+#include "ResultWriter.h"
+#include "ColumnarVariablesWriter.h"
+#include "BatchAggregator.h"
+#include <sstream>
 
 using namespace std;
 
+#ifdef ASYNC_EVALUATION_COROUTINES
+// Minimal fire-and-forget coroutine type, enough to co_await the async evaluation service
+struct DetachedTask
+{
+	struct promise_type
+	{
+		DetachedTask get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept { }
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
+DetachedTask awaitEvaluation(AsyncEvaluationService& service, string expression, CompiledExpression::VariableArray values, promise<string>& outcome)
+{
+	try
+	{
+		double result = co_await service.evaluateAsync(expression, values);
+		outcome.set_value(to_string(static_cast<int>(result)));
+	}
+	catch (const runtime_error& e)
+	{
+		outcome.set_value(e.what());
+	}
+}
+#endif
+
 int main()
 {
 	//Testing Deque specifically for valid and boundry
@@ -165,6 +219,114 @@ int main()
 	cout << "Should be: " << endl;
 	cout << endl;
 
+	// Testing fused pops and bulk operations
+	cout << "=== Testing fused pop and bulk operations ===" << endl;
+	vector<int> bulkItems = { 1, 2, 3, 4, 5, 6 };
+	testDeque.enqueueBack(bulkItems.begin(), bulkItems.end());
+	cout << "popFront: " << testDeque.popFront() << " popBack: " << testDeque.popBack() << endl;
+	cout << "Should be: popFront: 1 popBack: 6" << endl;
+
+	vector<int> poppedItems;
+	testDeque.popBack(3, back_inserter(poppedItems));
+	cout << "popBack(3): ";
+	for (int item : poppedItems)
+	{
+		cout << item << " ";
+	}
+	cout << "remaining: " << testDeque.peekFront() << endl;
+	cout << "Should be: popBack(3): 5 4 3 remaining: 2" << endl;
+
+	try
+	{
+		testDeque.popBack(2, back_inserter(poppedItems));
+	}
+	catch (const PrecondViolatedExcept& e)
+	{
+		cout << "Caught exception on popBack(2) with one item: " << e.what() << endl;
+	}
+	testDeque.popBack(1, back_inserter(poppedItems));
+	cout << "Deque is empty after popping the last item: " << (testDeque.isEmpty() ? "yes" : "no") << endl;
+	cout << "Should be: yes" << endl;
+	cout << endl;
+
+
+	// Testing versions of a persistent deque
+	cout << "=== Testing persistent deque versions ===" << endl;
+	{
+		auto printVersion = [](const PersistentDeque<int>& version)
+			{
+				version.forEach([](int item) { cout << item << " "; });
+				cout << endl;
+			};
+		PersistentDeque<int> original(bulkItems.begin(), bulkItems.end());
+		PersistentDeque<int> grown = original.withFront(0).withBack(7);
+		PersistentDeque<int> shrunk = original.withoutFront().withoutBack().withoutBack();
+		PersistentDeque<int> snapshot = grown;  // Shares every node, nothing is copied
+		cout << "Original: ";
+		printVersion(original);
+		cout << "Should be: 1 2 3 4 5 6 " << endl;
+		cout << "Grown: ";
+		printVersion(grown);
+		cout << "Should be: 0 1 2 3 4 5 6 7 " << endl;
+		cout << "Shrunk: ";
+		printVersion(shrunk);
+		cout << "Should be: 2 3 4 " << endl;
+		cout << "Snapshot front: " << snapshot.peekFront() << " back: " << snapshot.peekBack() << " length: " << snapshot.getLength() << endl;
+		cout << "Should be: Snapshot front: 0 back: 7 length: 8" << endl;
+
+		// Draining from one end empties every level of the tree in turn
+		PersistentDeque<int> drained = original;
+		cout << "Drained from the back: ";
+		while (!drained.isEmpty())
+		{
+			cout << drained.peekBack() << " ";
+			drained = drained.withoutBack();
+		}
+		cout << endl;
+		cout << "Should be: 6 5 4 3 2 1 " << endl;
+		try
+		{
+			drained.peekFront();
+		}
+		catch (const PrecondViolatedExcept& e)
+		{
+			cout << "Caught exception on peekFront with empty persistent deque: " << e.what() << endl;
+		}
+
+		// Read-only code can take either kind of deque
+		const DequeReadInterface<int>& readSide = shrunk;
+		cout << "Read interface front: " << readSide.peekFront() << endl;
+		cout << "Should be: 2" << endl;
+
+		InfixToPostfixEvaluation snapshotEvaluator;
+		snapshotEvaluator.convertInfixToPostfix("(a+b)*c");
+		PersistentDeque<char> programVersion = snapshotEvaluator.snapshotPostfixExpression();
+		snapshotEvaluator.convertInfixToPostfix("a-b");
+		cout << "Snapshot after reconversion: ";
+		programVersion.forEach([](char token) { cout << token; });
+		cout << " current: " << snapshotEvaluator.getPostfixExpression() << endl;
+		cout << "Should be: Snapshot after reconversion: ab+c* current: ab-" << endl;
+
+		// A long version chain is released without recursing
+		PersistentDeque<int> longVersion;
+		for (int i = 0; i < 200000; ++i)
+		{
+			longVersion = longVersion.withBack(i);
+		}
+		cout << "Long version length: " << longVersion.getLength() << endl;
+		cout << "Should be: 200000" << endl;
+
+		// Reusing one shared version costs the same every time
+		int sharedFront = 0;
+		for (int i = 0; i < 200; ++i)
+		{
+			sharedFront += longVersion.withoutFront().peekFront();
+		}
+		cout << "Sum of fronts after removing from the shared version: " << sharedFront << " length: " << longVersion.getLength() << endl;
+		cout << "Should be: 200 length: 200000" << endl;
+	}
+	cout << endl;
+
 
 	// Testing error handling for invalid values
 	cout << "=== Testing error handling on empty deque ===" << endl;
@@ -189,6 +351,16 @@ int main()
 		cout << "Caught exception on dequeueBack with empty deque: " << e.what() << endl;
 	}
 
+	// Test popFront on an empty deque
+	try
+	{
+		testDeque.popFront();
+	}
+	catch (const PrecondViolatedExcept& e)
+	{
+		cout << "Caught exception on popFront with empty deque: " << e.what() << endl;
+	}
+
 	// Test peekFront on an empty deque
 	try 
 	{
@@ -364,6 +536,1040 @@ int main()
 	}
 	cout << endl;
 
+	// Testing direct infix evaluation
+	cout << "=== Direct Infix Evaluation InfixToPostfixEvaluation ===" << endl;
+	evaluator.readValuesFromFile("variables.txt");
+
+	// Results should match converting to postfix and evaluating
+	for (const std::string& infixExpr : testExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		double postfixResult = evaluator.evaluatePostfixExpression();
+		double directResult = evaluator.evaluateInfixExpression(infixExpr);
+		cout << "Infix Expression: " << infixExpr << " Direct Result: " << directResult << endl;
+		cout << "Should be: " << postfixResult << endl;
+	}
+	cout << endl;
+
+	// Errors should match as well
+	evaluator.readValuesFromFile("boundaryVariables.txt");
+	try
+	{
+		result = evaluator.evaluateInfixExpression("a/b");
+		cout << "Result is: " << result << endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Division by zero" << endl << endl;
+	}
+
+	try
+	{
+		result = evaluator.evaluateInfixExpression("abcdef");
+		cout << "Result is: " << result << endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Invalid postfix expression" << endl << endl;
+	}
+	cout << endl;
+
+	// Testing execution backends
+	cout << "=== Execution Backends InfixToPostfixEvaluation ===" << endl;
+	evaluator.readValuesFromFile("variables.txt");
+
+	// Every backend should match evaluatePostfixExpression
+	for (const std::string& infixExpr : testExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+		double postfixResult = evaluator.evaluatePostfixExpression();
+
+		cout << "Infix Expression: " << infixExpr << endl;
+		for (ExecutionBackendKind kind : ExecutionBackendFactory::getAllKinds())
+		{
+			evaluator.setExecutionBackend(ExecutionBackendFactory::create(kind));
+			cout << "  " << ExecutionBackendFactory::create(kind)->getName() << ": "
+				<< evaluator.evaluateCompiledExpression(compiled) << endl;
+		}
+		cout << "Should be: " << postfixResult << endl;
+	}
+	cout << endl;
+
+	// Invalid expressions are rejected when compiled
+	try
+	{
+		evaluator.convertInfixToPostfix("abcdef");
+		CompiledExpression compiled = evaluator.compilePostfixExpression();
+		cout << "Compiled: " << compiled.getPostfixExpression() << endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Invalid postfix expression" << endl << endl;
+	}
+
+	// Division by zero is detected by every backend
+	evaluator.readValuesFromFile("boundaryVariables.txt");
+	evaluator.convertInfixToPostfix("a/b");
+	CompiledExpression divisionByZero = evaluator.compilePostfixExpression();
+	for (ExecutionBackendKind kind : ExecutionBackendFactory::getAllKinds())
+	{
+		evaluator.setExecutionBackend(ExecutionBackendFactory::create(kind));
+		try
+		{
+			result = evaluator.evaluateCompiledExpression(divisionByZero);
+			cout << "Result is: " << result << endl;
+		}
+		catch (const std::runtime_error& error)
+		{
+			cout << "Caught exception: " << error.what() << endl;
+		}
+	}
+	cout << "Expected output: Division by zero (once per backend)" << endl << endl;
+
+	// A left-deep chain of a million terms must not exhaust the call stack of any backend
+	evaluator.readValuesFromFile("variables.txt");
+	string deepChain = "a";
+	for (int i = 1; i < 1000000; ++i)
+	{
+		deepChain += "+a";
+	}
+	evaluator.convertInfixToPostfix(deepChain);
+	CompiledExpression deepExpression = evaluator.compilePostfixExpression();
+	deepChain.clear();
+	for (ExecutionBackendKind kind : ExecutionBackendFactory::getAllKinds())
+	{
+		evaluator.setExecutionBackend(ExecutionBackendFactory::create(kind));
+		cout << "  " << ExecutionBackendFactory::create(kind)->getName() << " deep chain: " << evaluator.evaluateCompiledExpression(deepExpression) << endl;
+	}
+	cout << "Should be: 5e+06 (once per backend)" << endl;
+	evaluator.setExecutionBackend(ExecutionBackendFactory::create(ExecutionBackendKind::StackReplay));
+	cout << endl;
+
+	// Testing precompiled program images
+	cout << "=== Program Image InfixToPostfixEvaluation ===" << endl;
+	evaluator.readValuesFromFile("variables.txt");
+	const CompiledExpression::VariableArray imageValues = { 5, 10, 15, 20, 25, 30 };
+
+	ProgramImageWriter imageWriter;
+	for (const std::string& infixExpr : testExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		imageWriter.addExpression(infixExpr, evaluator.compilePostfixExpression());
+	}
+	imageWriter.writeToFile("testExpressions.pfxp");
+
+	// Evaluating in place from the mapped file should match evaluatePostfixExpression
+	{
+		MappedFile mappedImage("testExpressions.pfxp");
+		ProgramImage image(mappedImage.data(), mappedImage.size());
+		cout << "Expressions in image: " << image.getExpressionCount() << endl;
+		cout << "Should be: 8" << endl;
+		for (size_t i = 0; i < image.getExpressionCount(); ++i)
+		{
+			evaluator.convertInfixToPostfix(testExpressions[i]);
+			cout << "Infix Expression: " << image.getInfixExpression(i) << " Image Result: " << image.evaluate(i, imageValues) << endl;
+			cout << "Should be: " << testExpressions[i] << " " << evaluator.evaluatePostfixExpression() << endl;
+		}
+	}
+	std::remove("testExpressions.pfxp");
+
+	// Testing a corrupted image
+	try
+	{
+		std::vector<unsigned char> corruptedImage = imageWriter.build();
+		corruptedImage[4] = 99;  // Unsupported version
+		ProgramImage image(corruptedImage.data(), corruptedImage.size());
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Unsupported program image version" << endl << endl;
+	}
+
+	// Testing an image whose bytecode was corrupted
+	try
+	{
+		std::vector<unsigned char> corruptedImage = imageWriter.build();
+		const ProgramImage::ImageHeader* corruptedHeader = reinterpret_cast<const ProgramImage::ImageHeader*>(corruptedImage.data());
+		corruptedImage[corruptedHeader->codeOffset] = 0xC8;  // Not an opcode
+		ProgramImage image(corruptedImage.data(), corruptedImage.size());
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Program image entry 0 has an invalid opcode" << endl << endl;
+	}
+
+	// Testing an image that claims a huge stack depth
+	try
+	{
+		std::vector<unsigned char> corruptedImage = imageWriter.build();
+		const ProgramImage::ImageHeader* corruptedHeader = reinterpret_cast<const ProgramImage::ImageHeader*>(corruptedImage.data());
+		ProgramImage::ImageIndexEntry* corruptedEntry = reinterpret_cast<ProgramImage::ImageIndexEntry*>(corruptedImage.data() + corruptedHeader->indexOffset);
+		corruptedEntry->maxStackDepth = 0xFFFFFFFF;
+		ProgramImage image(corruptedImage.data(), corruptedImage.size());
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Program image entry 0 has the wrong stack depth" << endl << endl;
+	}
+	cout << endl;
+
+	cout << "=== Shared Program Store InfixToPostfixEvaluation ===" << endl;
+	SharedProgramStore::remove("PostfixWithDequeTest");  // Left over from an interrupted run
+	{
+		SharedProgramStore publisher("PostfixWithDequeTest", imageWriter);
+
+		// A worker process attaches by name; a second mapping in this process stands in for it
+		SharedProgramStore worker("PostfixWithDequeTest");
+		cout << "Expressions in store: " << worker.getExpressionCount() << endl;
+		cout << "Should be: 8" << endl;
+		cout << "Infix Expression: " << worker.getImage().getInfixExpression(7) << " Store Result: " << worker.evaluate(7, imageValues) << endl;
+		cout << "Should be: a*(b+c)*(d-e)+f -595" << endl;
+
+		try
+		{
+			SharedProgramStore duplicate("PostfixWithDequeTest", imageWriter);
+		}
+		catch (const std::runtime_error& error)
+		{
+			cout << "Caught exception: " << error.what() << endl;
+		}
+		cout << "Expected output: Could not create shared program store: PostfixWithDequeTest" << endl;
+	}
+	SharedProgramStore::remove("PostfixWithDequeTest");
+	cout << endl;
+
+	// Testing the on-disk conversion cache
+	cout << "=== Disk Cache InfixToPostfixEvaluation ===" << endl;
+	{
+		PostfixDiskCache cache("testCache", 1 << 20);
+		cache.clear();
+
+		bool firstHit = cache.convert(evaluator, "(a+b)*c");
+		cout << "First conversion from cache: " << (firstHit ? "yes" : "no") << endl;
+		cout << "Should be: no" << endl;
+
+		// Differently formatted text normalizes to the same entry
+		bool secondHit = cache.convert(evaluator, "( A + B ) * C");
+		cout << "Second conversion from cache: " << (secondHit ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+		cout << "Postfix expression: " << evaluator.getPostfixExpression() << endl;
+		cout << "Should be: ab+c*" << endl;
+		cout << "Result is: " << evaluator.evaluatePostfixExpression() << endl;
+		cout << "Should be: 225" << endl << endl;
+
+		// An entry cut short on disk is a miss, not a wrong postfix expression
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("testCache"))
+		{
+			std::filesystem::resize_file(entry.path(), entry.file_size() - 20);
+		}
+		std::string truncatedPostfix;
+		cout << "Truncated entry found: " << (cache.lookup("(a+b)*c", truncatedPostfix) ? "yes" : "no") << endl;
+		cout << "Should be: no" << endl;
+		cout << "Conversion after truncation from cache: " << (cache.convert(evaluator, "(a+b)*c") ? "yes" : "no") << " " << evaluator.getPostfixExpression() << endl;
+		cout << "Should be: no ab+c*" << endl << endl;
+	}
+
+	// Reopening the cache removes abandoned temporary files but not a write still in progress
+	{
+		std::ofstream("testCache/inflight.pfx.tmp1") << "x";
+		std::ofstream("testCache/abandoned.pfx.tmp2") << "x";
+		std::filesystem::last_write_time("testCache/abandoned.pfx.tmp2", std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+		PostfixDiskCache cache("testCache", 1 << 20);
+		cout << "In-flight temporary kept: " << (std::filesystem::exists("testCache/inflight.pfx.tmp1") ? "yes" : "no")
+			<< " abandoned temporary removed: " << (!std::filesystem::exists("testCache/abandoned.pfx.tmp2") ? "yes" : "no") << endl;
+		cout << "Should be: In-flight temporary kept: yes abandoned temporary removed: yes" << endl << endl;
+		std::filesystem::remove("testCache/inflight.pfx.tmp1");
+	}
+
+	// A cache reopened with a tiny limit evicts old entries
+	{
+		PostfixDiskCache cache("testCache", 1);
+		std::string postfixExpr;
+		cout << "Entry still cached after eviction: " << (cache.lookup("(a+b)*c", postfixExpr) ? "yes" : "no") << endl;
+		cout << "Should be: no" << endl << endl;
+	}
+	std::filesystem::remove_all("testCache");
+	cout << endl;
+
+	// Testing tracing
+	cout << "=== Tracing InfixToPostfixEvaluation ===" << endl;
+	Tracer::reset();
+	Tracer::enable();
+	evaluator.readValuesFromFile("variables.txt");
+	evaluator.convertInfixToPostfix("(a+b)*c");
+	result = evaluator.evaluatePostfixExpression();
+	Tracer::disable();
+	evaluator.convertInfixToPostfix("a+b");  // Not recorded
+
+	Tracer::OpcodeHistogram histogram = Tracer::getOpcodeHistogram();
+	cout << "Loads: " << histogram[0] + histogram[1] + histogram[2] << " Adds: " << histogram[6] << " Multiplies: " << histogram[8] << endl;
+	cout << "Should be: Loads: 3 Adds: 1 Multiplies: 1" << endl;
+
+	std::string trace = Tracer::exportChromeTrace();
+	cout << "Trace contains convertInfixToPostfix: " << (trace.find("convertInfixToPostfix") != std::string::npos ? "yes" : "no") << endl;
+	cout << "Should be: yes" << endl;
+	cout << "Trace contains readValuesFromFile: " << (trace.find("readValuesFromFile") != std::string::npos ? "yes" : "no") << endl;
+	cout << "Should be: yes" << endl;
+	Tracer::reset();
+
+	// The buffer of a thread that has exited is released after its spans are exported, and its opcode counts are kept
+	Tracer::enable();
+	std::thread([]()
+		{
+			InfixToPostfixEvaluation threadEvaluator;
+			threadEvaluator.convertInfixToPostfix("a-b");
+			threadEvaluator.evaluatePostfixExpression();
+		}).join();
+	Tracer::disable();
+	std::string firstExport = Tracer::exportChromeTrace();
+	std::string secondExport = Tracer::exportChromeTrace();
+	cout << "Exited thread's spans in first export: " << (firstExport.find("convertInfixToPostfix") != std::string::npos ? "yes" : "no")
+		<< " second export: " << (secondExport.find("convertInfixToPostfix") != std::string::npos ? "yes" : "no")
+		<< " subtracts: " << Tracer::getOpcodeHistogram()[7] << endl;
+	cout << "Should be: Exited thread's spans in first export: yes second export: no subtracts: 1" << endl;
+	Tracer::reset();
+	cout << endl;
+
+	// Testing shared evaluation of a batch of formulas
+	cout << "=== Expression Batch InfixToPostfixEvaluation ===" << endl;
+	{
+		ExpressionBatch batch;
+		std::string batchExpressions[] = { "(a+b)*c", "(b+a)*d", "c*(a+b)", "a/b" };
+		for (const std::string& infixExpr : batchExpressions)
+		{
+			evaluator.convertInfixToPostfix(infixExpr);
+			batch.addFormula(evaluator.getPostfixExpression());
+		}
+		cout << "Deduplicated operations: " << batch.getDeduplicatedOperationCount() << " of " << batch.getTotalOperationCount() << endl;
+		cout << "Should be: 3 of 7" << endl;
+
+		std::vector<FormulaResult> batchResults;
+		batch.evaluate({ 5, 10, 15, 20, 25, 30 }, batchResults);
+		cout << "Results: " << batchResults[0].value << " " << batchResults[1].value << " " << batchResults[2].value << " " << batchResults[3].value << endl;
+		cout << "Should be: 225 300 225 0.5" << endl;
+
+		// Division by zero only fails the formulas that divide
+		batch.evaluate({ 5, 0, 15, 20, 25, 30 }, batchResults);
+		cout << "Valid: " << batchResults[0].valid << " " << batchResults[1].valid << " " << batchResults[2].valid << " " << batchResults[3].valid << endl;
+		cout << "Should be: 1 1 1 0" << endl;
+	}
+	cout << endl;
+
+	// Testing the register VM
+	cout << "=== Register VM InfixToPostfixEvaluation ===" << endl;
+	evaluator.readValuesFromFile("variables.txt");
+	for (const std::string& infixExpr : testExpressions)
+	{
+		evaluator.convertInfixToPostfix(infixExpr);
+		RegisterProgram registerProgram(evaluator.compilePostfixExpression());
+		cout << "Infix Expression: " << infixExpr << " Register Result: " << registerProgram.evaluate({ 5, 10, 15, 20, 25, 30 })
+			<< " Fused: " << registerProgram.getFusedInstructionCount() << endl;
+		cout << "Should be: " << evaluator.evaluatePostfixExpression() << endl;
+	}
+
+	try
+	{
+		evaluator.convertInfixToPostfix("a/b");
+		RegisterProgram registerProgram(evaluator.compilePostfixExpression());
+		result = registerProgram.evaluate({ 5, 0, 15, 20, 25, 30 });
+		cout << "Result is: " << result << endl;
+	}
+	catch (const std::runtime_error& error)
+	{
+		cout << "Caught exception: " << error.what() << endl;
+		cout << "Expected output: Division by zero" << endl << endl;
+	}
+	cout << endl;
+
+	// Testing many formulas on one row across lanes
+	cout << "=== Multi-Expression Evaluation InfixToPostfixEvaluation ===" << endl;
+	{
+		MultiExpressionEvaluator multiEvaluator;
+		std::string laneExpressions[] = { "a+b*c", "d+e*f", "(a+b)*c", "b+a*a", "a/b" };
+		for (const std::string& infixExpr : laneExpressions)
+		{
+			evaluator.convertInfixToPostfix(infixExpr);
+			multiEvaluator.addFormula(evaluator.getPostfixExpression());
+		}
+		cout << "Groups: " << multiEvaluator.getGroupCount() << endl;
+		cout << "Should be: 3" << endl;
+
+		std::vector<FormulaResult> laneResults;
+		multiEvaluator.evaluate({ 5, 10, 15, 20, 25, 30 }, laneResults);
+		cout << "Results:";
+		for (const FormulaResult& laneResult : laneResults)
+		{
+			cout << " " << laneResult.value;
+		}
+		cout << endl << "Should be: 155 770 225 35 0.5" << endl;
+
+		multiEvaluator.evaluate({ 5, 0, 15, 20, 25, 30 }, laneResults);
+		cout << "Division by zero reported: " << (!laneResults[4].valid ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+
+		// A formula added after evaluating joins its group's lanes
+		evaluator.convertInfixToPostfix("c+a*f");
+		multiEvaluator.addFormula(evaluator.getPostfixExpression());
+		multiEvaluator.evaluate({ 5, 10, 15, 20, 25, 30 }, laneResults);
+		cout << "Groups: " << multiEvaluator.getGroupCount() << " first: " << laneResults[0].value << " added: " << laneResults[5].value << endl;
+		cout << "Should be: Groups: 3 first: 155 added: 165" << endl;
+	}
+	cout << endl;
+
+	// Testing a per-request arena
+	cout << "=== JIT Program InfixToPostfixEvaluation ===" << endl;
+	{
+		evaluator.convertInfixToPostfix("a*(b+c)*(d-e)+f");
+		JitProgram jitProgram(evaluator.compilePostfixExpression());
+		cout << "Runs as native code: " << (jitProgram.isNative() ? "yes" : "no") << endl;
+		cout << "Should be: yes on Linux x86-64, no elsewhere" << endl;
+
+		// Three rows of columnar input, one array per variable
+		const int32_t columnA[] = { 5, 1, 2 }, columnB[] = { 10, 2, 4 }, columnC[] = { 15, 3, 6 };
+		const int32_t columnD[] = { 20, 4, 8 }, columnE[] = { 25, 5, 10 }, columnF[] = { 30, 6, 12 };
+		const int32_t* columns[] = { columnA, columnB, columnC, columnD, columnE, columnF };
+		double columnResults[3];
+		jitProgram.evaluateColumns(columns, columnResults, 3);
+		cout << "Column results: " << columnResults[0] << " " << columnResults[1] << " " << columnResults[2] << endl;
+		cout << "Should be: -595 1 -28" << endl;
+
+		evaluator.convertInfixToPostfix("a/(b-c)");
+		JitProgram dividingProgram(evaluator.compilePostfixExpression());
+		try
+		{
+			dividingProgram.evaluate({ 1, 5, 5, 0, 0, 0 });
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Division by zero" << endl;
+
+		// Deeper than the xmm registers, so it falls back to the interpreter
+		evaluator.convertInfixToPostfix("a+(b+(c+(d+(e+(f+(a+(b+(c+(d+(e+(f+(a+(b+(c+(d+e)))))))))))))))");
+		JitProgram deepProgram(evaluator.compilePostfixExpression());
+		cout << "Deep program native: " << (deepProgram.isNative() ? "yes" : "no") << " result: " << deepProgram.evaluate({ 1, 2, 3, 4, 5, 6 }) << endl;
+		cout << "Should be: Deep program native: no result: 57" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Chain Program InfixToPostfixEvaluation ===" << endl;
+	{
+		// 3000 terms of a+b+c+d+e+f+a+..., converted into one left-deep chain
+		string longChain = "a";
+		for (int i = 1; i < 3000; ++i)
+		{
+			longChain += '+';
+			longChain += static_cast<char>('a' + i % 6);
+		}
+		evaluator.convertInfixToPostfix(longChain);
+		CompiledExpression chainExpression = evaluator.compilePostfixExpression();
+		ChainProgram sequentialProgram(chainExpression);
+		cout << "Chains: " << sequentialProgram.getChainCount() << " longest: " << sequentialProgram.getLongestChain() << endl;
+		cout << "Should be: Chains: 1 longest: 3000" << endl;
+		cout << "Sequential result: " << sequentialProgram.evaluate({ 1, 2, 3, 4, 5, 6 }) << endl;
+		cout << "Should be: 10500" << endl;
+
+		// Terms that do not divide evenly, so the two orders may round differently, but thread count never matters
+		string fractionChain = "a/b";
+		for (int i = 1; i < 20000; ++i)
+		{
+			fractionChain += i % 2 == 0 ? "+a/b" : "+c/d";
+		}
+		evaluator.convertInfixToPostfix(fractionChain);
+		CompiledExpression fractionExpression = evaluator.compilePostfixExpression();
+		ChainProgram exactProgram(fractionExpression);
+		ChainProgram pairwiseProgram(fractionExpression, ChainProgram::ReductionOrder::Pairwise);
+		CompiledExpression::VariableArray fractionValues = { 1, 3, 2, 7, 0, 0 };
+		double singleThreaded = pairwiseProgram.evaluate(fractionValues);
+		pairwiseProgram.setThreadCount(4);
+		double multiThreaded = pairwiseProgram.evaluate(fractionValues);
+		InfixToPostfixEvaluation fractionEvaluator;
+		fractionEvaluator.setVariableValues(fractionValues);
+		fractionEvaluator.convertInfixToPostfix(fractionChain);
+		cout << "Sequential matches evaluator: " << (exactProgram.evaluate(fractionValues) == fractionEvaluator.evaluatePostfixExpression() ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+		cout << "Pairwise same on 1 and 4 threads: " << (singleThreaded == multiThreaded ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+
+		// Right-nested runs are only flattened in pairwise order
+		evaluator.convertInfixToPostfix("a*(b*(c*(d*(e*(f*(a*b))))))");
+		CompiledExpression nestedExpression = evaluator.compilePostfixExpression();
+		cout << "Nested chains sequential: " << ChainProgram(nestedExpression).getChainCount()
+			<< " pairwise: " << ChainProgram(nestedExpression, ChainProgram::ReductionOrder::Pairwise).getChainCount() << endl;
+		cout << "Should be: Nested chains sequential: 0 pairwise: 1" << endl;
+
+		evaluator.convertInfixToPostfix("a+b+c+d+e+f+a+b/(c-c)");
+		try
+		{
+			ChainProgram(evaluator.compilePostfixExpression()).evaluate({ 1, 2, 3, 4, 5, 6 });
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Division by zero" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Memory Resource InfixToPostfixEvaluation ===" << endl;
+	{
+		// Every allocation must come from the buffer, the null upstream resource throws if it runs out
+		std::array<std::byte, 64 * 1024> requestBuffer;
+		std::pmr::monotonic_buffer_resource requestArena(requestBuffer.data(), requestBuffer.size(), std::pmr::null_memory_resource());
+		InfixToPostfixEvaluation arenaEvaluator(&requestArena);
+		arenaEvaluator.readValuesFromFile("variables.txt");
+
+		arenaEvaluator.convertInfixToPostfix("a*(b+c)*(d-e)+f");
+		cout << "Postfix expression: " << arenaEvaluator.getPostfixExpression() << endl;
+		cout << "Should be: abc+*de-*f+" << endl;
+		cout << "Result is: " << arenaEvaluator.evaluatePostfixExpression() << endl;
+		cout << "Should be: -595" << endl;
+		cout << "Direct result is: " << arenaEvaluator.evaluateInfixExpression("(a+b)*c") << endl;
+		cout << "Should be: 225" << endl;
+
+		// Backends take their scratch storage from the evaluator's arena, so none of them touches the default resource
+		arenaEvaluator.convertInfixToPostfix("a*(b+c)*(d-e)+f");
+		CompiledExpression arenaCompiled = arenaEvaluator.compilePostfixExpression();
+		std::pmr::memory_resource* previousDefault = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+		cout << "Backend results from the arena:";
+		for (ExecutionBackendKind kind : ExecutionBackendFactory::getAllKinds())
+		{
+			arenaEvaluator.setExecutionBackend(ExecutionBackendFactory::create(kind));
+			cout << " " << arenaEvaluator.evaluateCompiledExpression(arenaCompiled);
+		}
+		std::pmr::set_default_resource(previousDefault);
+		cout << endl << "Should be: -595 -595 -595" << endl;
+
+		LinkedDeque<int> arenaDeque(&requestArena);
+		arenaDeque.enqueueBack(1);
+		LinkedDeque<int> defaultCopy = arenaDeque;
+		cout << "Copy uses the default resource: " << (defaultCopy.getMemoryResource() == std::pmr::get_default_resource() ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+		LinkedDeque<int> arenaCopy(arenaDeque, &requestArena);
+		cout << "Allocator-extended copy uses the arena: " << (arenaCopy.getMemoryResource() == &requestArena ? "yes" : "no") << " " << arenaCopy.peekFront() << endl;
+		cout << "Should be: yes 1" << endl;
+	}  // The arena releases everything at once here
+
+	// Testing an arena too small for the expression
+	try
+	{
+		std::array<std::byte, 512> smallBuffer;
+		std::pmr::monotonic_buffer_resource smallArena(smallBuffer.data(), smallBuffer.size(), std::pmr::null_memory_resource());
+		InfixToPostfixEvaluation smallEvaluator(&smallArena);
+		smallEvaluator.convertInfixToPostfix("a*(b+c)*(d-e)+f-a*(b+c)*(d-e)+f-a*(b+c)*(d-e)+f");
+	}
+	catch (const std::bad_alloc&)
+	{
+		cout << "Caught exception: std::bad_alloc" << endl;
+		cout << "Expected output: std::bad_alloc" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Streaming Converter ===" << endl;
+	{
+		// A tiny chunk size forces the expression to be split across many reads and writes
+		ostringstream streamedPostfix;
+		StreamingConverter streamingConverter(streamedPostfix, 3);
+		istringstream infixStream("(A + B) * (C - D) / E + F * (A - B)");
+		streamingConverter.convert(infixStream);
+		evaluator.convertInfixToPostfix("(A + B) * (C - D) / E + F * (A - B)");
+		cout << "Streamed postfix: " << streamedPostfix.str() << endl;
+		cout << "Should be: " << evaluator.getPostfixExpression() << endl;
+		cout << "Max operator depth: " << streamingConverter.getMaxOperatorDepth() << endl;
+		cout << "Should be: 4" << endl;
+
+		// A long generated expression read back from a file descriptor
+		FILE* infixFile = tmpfile();
+		string longInfix = "a";
+		for (int i = 0; i < 10000; ++i)
+		{
+			longInfix += (i % 2 == 0) ? "+(b*c)" : "-d";
+		}
+		fputs(longInfix.c_str(), infixFile);
+		fflush(infixFile);
+		rewind(infixFile);
+		size_t postfixLength = 0;
+		StreamingConverter descriptorConverter([&postfixLength](const char*, size_t length) { postfixLength += length; }, 256);
+		descriptorConverter.convert(fileno(infixFile));
+		fclose(infixFile);
+		cout << "Postfix tokens from descriptor: " << postfixLength << endl;
+		cout << "Should be: 30001" << endl;
+
+		istringstream unbalancedStream("(a+b");
+		try
+		{
+			streamingConverter.convert(unbalancedStream);
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Invalid infix expression" << endl;
+
+		// Counters start over with each expression fed after a finish
+		ostringstream fedPostfix;
+		StreamingConverter fedConverter(fedPostfix);
+		fedConverter.feed("(a+b)*(c-d)", 11);
+		fedConverter.finish();
+		fedConverter.feed("a+b", 3);
+		fedConverter.finish();
+		cout << "Tokens and depth of the second expression: " << fedConverter.getTokensEmitted() << " " << fedConverter.getMaxOperatorDepth() << endl;
+		cout << "Should be: 3 1" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Bulk Converter ===" << endl;
+	{
+		const vector<string> catalog = { "(a+b)*c", "a+b)", "a*(b+c)*(d-e)+f", "(a+b", "a+b*g", "a/b-c" };
+		BulkConverter bulkConverter(2);
+		bulkConverter.convert(catalog);
+		for (size_t i = 0; i < bulkConverter.getExpressionCount(); ++i)
+		{
+			cout << i << ": " << (bulkConverter.isConverted(i) ? string(bulkConverter.getPostfixExpression(i)) : "failed") << endl;
+		}
+		cout << "Should be: ab+c* failed abc+*de-*f+ failed failed ab/c-" << endl;
+		cout << "Packed buffer: " << bulkConverter.getPostfixBuffer() << endl;
+		cout << "Should be: ab+c*abc+*de-*f+ab/c-" << endl;
+		for (const BulkConverter::ConversionFailure& failure : bulkConverter.getFailures())
+		{
+			cout << "Failure " << failure.index << ": " << failure.message << endl;
+		}
+		cout << "Should be: Failure 1: Invalid infix expression, Failure 3: Invalid infix expression, Failure 4: Unknown operator encountered" << endl;
+
+		// Only the second range pushes operators, so the allocation failure happens on a worker thread
+		std::pmr::memory_resource* previousDefault = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+		try
+		{
+			bulkConverter.convert(vector<string>{ "a", "b", "a+b", "c*d" });
+			cout << "No exception" << endl;
+		}
+		catch (const std::bad_alloc&)
+		{
+			cout << "Caught exception: std::bad_alloc" << endl;
+		}
+		std::pmr::set_default_resource(previousDefault);
+		cout << "Expected output: std::bad_alloc" << endl;
+		cout << "Expressions kept: " << bulkConverter.getExpressionCount() << endl;
+		cout << "Should be: 6" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Latency Histogram ===" << endl;
+	{
+		LatencyHistogram histogram;
+		for (uint64_t latency = 1; latency <= 1000; ++latency)
+		{
+			histogram.record(latency * 1000);
+		}
+		cout << "p50: " << histogram.getValueAtPercentile(50) << " p99: " << histogram.getValueAtPercentile(99) << endl;
+		cout << "Should be within 1% of: p50: 500000 p99: 990000" << endl;
+
+		LatencyHistogram otherThread;
+		otherThread.record(5);
+		histogram.merge(otherThread);
+		cout << "Merged count: " << histogram.getCount() << " min: " << histogram.getMin() << " max: " << histogram.getMax() << endl;
+		cout << "Should be: Merged count: 1001 min: 5 max: 1000000" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Columnar Variables ===" << endl;
+	{
+		evaluator.convertInfixToPostfix("(a+b)*c-f/e");
+		JitProgram columnProgram(evaluator.compilePostfixExpression());
+
+		// All six int32 columns: the mapped columns are evaluated in place
+		ColumnarVariablesWriter int32Writer(ColumnarVariables::ColumnType::Int32);
+		cout << "Rows read from text: " << int32Writer.readTextFile("variables.txt") << endl;
+		cout << "Should be: 1" << endl;
+		int32Writer.addRow({ 1, 2, 3, 4, 5, 10 });
+		int32Writer.writeToFile("testColumns.pfxc");
+		{
+			MappedFile mappedColumns("testColumns.pfxc");
+			ColumnarVariables columns(mappedColumns.data(), mappedColumns.size());
+			double columnResults[2];
+			columns.evaluate(columnProgram, columnResults);
+			cout << "Rows: " << columns.getRowCount() << " column b: " << columns.getColumn<int32_t>("b")[1]
+				<< " results: " << columnResults[0] << " " << columnResults[1] << endl;
+			cout << "Should be: Rows: 2 column b: 2 results: 223.8 7" << endl;
+		}
+		std::remove("testColumns.pfxc");
+
+		// Double columns without f: narrowed block by block, and the missing variable reads 0
+		ColumnarVariablesWriter doubleWriter(ColumnarVariables::ColumnType::Double, { "a", "b", "c", "e" });
+		doubleWriter.addRow({ 5, 5, 15, 20 });
+		vector<unsigned char> doubleFile = doubleWriter.build();
+		ColumnarVariables doubleColumns(doubleFile.data(), doubleFile.size());
+		double doubleResult;
+		doubleColumns.evaluate(columnProgram, &doubleResult);
+		cout << "Double columns result: " << doubleResult << endl;
+		cout << "Should be: 150" << endl;
+
+		ColumnarVariablesWriter fractionWriter(ColumnarVariables::ColumnType::Double);
+		fractionWriter.addRow({ 1.5, 2, 3, 4, 5, 6 });
+		vector<unsigned char> fractionFile = fractionWriter.build();
+		try
+		{
+			ColumnarVariables(fractionFile.data(), fractionFile.size()).evaluate(columnProgram, &doubleResult);
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Column value is not an int: 1.500000" << endl;
+
+		try
+		{
+			ColumnarVariables(fractionFile.data(), fractionFile.size() - 8);
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Columnar file column 5 is out of bounds" << endl;
+
+		try
+		{
+			int32Writer.readTextFile("invalidVariables.txt");
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: File does not contain enough values." << endl;
+
+		// Values that do not fit the column type are rejected instead of wrapping, and the row is left out
+		try
+		{
+			int32Writer.addRow({ 1, 2, 3, 4, 5, 3e9 });
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Value is not an int32: 3000000000.000000" << endl;
+		try
+		{
+			int32Writer.addRow({ 1, 2, 3 });
+		}
+		catch (const invalid_argument& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Row has 3 values for 6 columns" << endl;
+		cout << "Rows kept: " << int32Writer.getRowCount() << endl;
+		cout << "Should be: 2" << endl;
+
+		// int64 rows keep values a double would round
+		ColumnarVariablesWriter int64Writer(ColumnarVariables::ColumnType::Int64, { "a" });
+		int64Writer.addRow(vector<int64_t>{ 9007199254740993 });
+		vector<unsigned char> int64File = int64Writer.build();
+		ColumnarVariables int64Columns(int64File.data(), int64File.size());
+		cout << "Int64 value: " << int64Columns.getColumn<int64_t>("a")[0] << endl;
+		cout << "Should be: 9007199254740993" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Batch Aggregation ===" << endl;
+	{
+		// 10000 rows of a/b+c with b = row % 7, so every seventh row divides by zero
+		const size_t aggregateRows = 10000;
+		vector<int32_t> columnA(aggregateRows), columnB(aggregateRows), columnC(aggregateRows);
+		for (size_t row = 0; row < aggregateRows; ++row)
+		{
+			columnA[row] = static_cast<int32_t>(row % 100);
+			columnB[row] = static_cast<int32_t>(row % 7);
+			columnC[row] = static_cast<int32_t>(row % 13) - 6;
+		}
+		const int32_t* aggregateColumns[] = { columnA.data(), columnB.data(), columnC.data(), nullptr, nullptr, nullptr };
+		evaluator.convertInfixToPostfix("a/b+c");
+		JitProgram aggregateProgram(evaluator.compilePostfixExpression());
+
+		// The same aggregates computed one row at a time
+		ResultAggregate expected({ 0, 10 });
+		for (size_t row = 0; row < aggregateRows; ++row)
+		{
+			try
+			{
+				expected.record(aggregateProgram.evaluate({ columnA[row], columnB[row], columnC[row], 0, 0, 0 }));
+			}
+			catch (const runtime_error&)
+			{
+				expected.recordDivisionByZero();
+			}
+		}
+
+		BatchAggregator batchAggregator;
+		ResultAggregate fused = batchAggregator.aggregate(aggregateProgram, aggregateColumns, aggregateRows, { 0, 10 });
+		cout << "Count: " << fused.getCount() << " division by zero: " << fused.getDivisionByZeroCount()
+			<< " min: " << fused.getMin() << " max: " << fused.getMax() << endl;
+		cout << "Should be: Count: 8571 division by zero: 1429 min: -6 max: 105" << endl;
+		cout << "Buckets: " << fused.getBucketCounts()[0] << " " << fused.getBucketCounts()[1] << " " << fused.getBucketCounts()[2] << endl;
+		cout << "Should be: 488 2508 5575" << endl;
+		cout << "Matches row by row: " << (fused.getBucketCounts() == expected.getBucketCounts() && fused.getCount() == expected.getCount() ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+		cout << "Mean matches row by row: " << (abs(fused.getMean() - expected.getMean()) < 1e-9 ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+
+		batchAggregator.setThreadCount(4);
+		ResultAggregate threaded = batchAggregator.aggregate(aggregateProgram, aggregateColumns, aggregateRows, { 0, 10 });
+		cout << "Sum identical on 1 and 4 threads: " << (threaded.getSum() == fused.getSum() ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+
+		try
+		{
+			ResultAggregate unsorted({ 5, 1 });
+		}
+		catch (const invalid_argument& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Bucket bounds must be strictly ascending" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Result Writer ===" << endl;
+	{
+		const double firstColumn[] = { 225, -595, 0.1, 1e300 };
+		const double secondColumn[] = { -2.5, 3, 1.0 / 3, 0 };
+		const double* columns[] = { firstColumn, secondColumn };
+		{
+			// A tiny buffer forces several flushes
+			ResultWriter csvWriter("testResults.csv", 64);
+			csvWriter.writeCsvHeader({ "first", "second" });
+			csvWriter.writeCsvRows(columns, 2, 4);
+			csvWriter.writeCsv(firstColumn, 2);
+		}
+		ifstream csvFile("testResults.csv");
+		stringstream csvText;
+		csvText << csvFile.rdbuf();
+		cout << csvText.str();
+		cout << "Should be:" << endl << "first,second" << endl << "225,-2.5" << endl << "-595,3" << endl
+			<< "0.1,0.3333333333333333" << endl << "1e+300,0" << endl << "225" << endl << "-595" << endl;
+		csvFile.close();
+
+		{
+			ResultWriter binaryWriter("testResults.bin", 128);
+			binaryWriter.writeBinaryColumn(secondColumn, 4);
+			binaryWriter.writeBinaryColumn(firstColumn, 4);
+			binaryWriter.flush();
+			cout << "Binary bytes written: " << binaryWriter.getBytesWritten() << endl;
+			cout << "Should be: 64" << endl;
+		}
+		ifstream binaryFile("testResults.bin", ios::binary);
+		unsigned char encoded[64];
+		binaryFile.read(reinterpret_cast<char*>(encoded), sizeof(encoded));
+		uint64_t bits = 0;
+		for (int byte = 7; byte >= 0; --byte)
+		{
+			bits = (bits << 8) | encoded[8 + byte];  // Second value of the first column, little-endian
+		}
+		double decoded;
+		memcpy(&decoded, &bits, sizeof(decoded));
+		cout << "Decoded binary value: " << decoded << endl;
+		cout << "Should be: 3" << endl;
+		binaryFile.close();
+		std::remove("testResults.csv");
+		std::remove("testResults.bin");
+
+		try
+		{
+			ResultWriter missingDirectory("no_such_directory/results.csv");
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Could not create results file no_such_directory/results.csv" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Shared Program Per-Thread Context ===" << endl;
+	{
+		evaluator.readValuesFromFile("variables.txt");
+		evaluator.convertInfixToPostfix("a*(b+c)*(d-e)+f");
+		const CompiledExpression sharedProgram = evaluator.compilePostfixExpression();
+
+		// Every thread evaluates the same program through its own context
+		vector<double> threadResults(4);
+		vector<thread> contextThreads;
+		for (size_t i = 0; i < threadResults.size(); ++i)
+		{
+			contextThreads.emplace_back([&, i]
+				{
+					EvaluationContext context = evaluator.createEvaluationContext();
+					double total = 0;
+					for (int repetition = 0; repetition < 1000; ++repetition)
+					{
+						total += context.evaluate(sharedProgram);
+					}
+					threadResults[i] = total / 1000;
+				});
+		}
+		for (thread& contextThread : contextThreads)
+		{
+			contextThread.join();
+		}
+		cout << "Thread results: ";
+		for (double result : threadResults)
+		{
+			cout << result << " ";
+		}
+		cout << endl;
+		cout << "Should be: -595 -595 -595 -595" << endl;
+
+		EvaluationContext context({ 1, 2, 3, 4, 5, 6 });
+		cout << "Own values result: " << context.evaluate(sharedProgram) << endl;
+		cout << "Should be: 1" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Result Memo ===" << endl;
+	{
+		ResultMemo memo(2);
+		evaluator.convertInfixToPostfix("(a+b)*c");
+		size_t memoId = memo.addExpression(evaluator.compilePostfixExpression());
+
+		// Rows differing only in d-f share an entry because (a+b)*c never reads them
+		cout << "First: " << memo.evaluate(memoId, { 5, 10, 15, 1, 2, 3 }) << endl;
+		cout << "Second: " << memo.evaluate(memoId, { 5, 10, 15, 7, 8, 9 }) << endl;
+		cout << "Should be: 225 then 225" << endl;
+		cout << "Hits: " << memo.getHitCount() << " misses: " << memo.getMissCount() << endl;
+		cout << "Should be: Hits: 1 misses: 1" << endl;
+
+		// Two new rows overflow the two slots; the hit row survives the first eviction
+		memo.evaluate(memoId, { 1, 1, 1, 0, 0, 0 });
+		memo.evaluate(memoId, { 2, 2, 2, 0, 0, 0 });
+		cout << "Evictions: " << memo.getEvictionCount() << " size: " << memo.getSize() << endl;
+		cout << "Should be: Evictions: 1 size: 2" << endl;
+
+		try
+		{
+			memo.evaluate(memoId + 1, { 1, 1, 1, 1, 1, 1 });
+		}
+		catch (const out_of_range& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Unknown memo expression id" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Variable Store Snapshots ===" << endl;
+	{
+		VariableStore store("variables.txt");
+		evaluator.convertInfixToPostfix("(a+b)*c");
+		const CompiledExpression storeProgram = evaluator.compilePostfixExpression();
+
+		// A reader keeps checking that every pinned snapshot is a complete set while a writer publishes
+		atomic<bool> publishing(true);
+		atomic<bool> sawTornSnapshot(false);
+		thread snapshotReader([&]
+			{
+				EvaluationContext context;
+				while (publishing)
+				{
+					VariableStore::Reader reader(store);
+					const CompiledExpression::VariableArray& pinned = reader.values();
+					for (int value : pinned)
+					{
+						if (value != pinned[0])
+						{
+							sawTornSnapshot = true;
+						}
+					}
+					context.setVariableValues(pinned);
+					context.evaluate(storeProgram);
+				}
+			});
+		for (int version = 1; version <= 200; ++version)
+		{
+			store.publish({ version, version, version, version, version, version });
+		}
+		publishing = false;
+		snapshotReader.join();
+		cout << "Version after 200 publishes: " << store.getVersion() << endl;
+		cout << "Should be: 200" << endl;
+		cout << "Reader saw a torn snapshot: " << (sawTornSnapshot ? "yes" : "no") << endl;
+		cout << "Should be: no" << endl;
+
+		store.loadFromFile("variables.txt");
+		{
+			VariableStore::Reader reader(store);
+			EvaluationContext context(reader.values());
+			cout << "Result with reloaded values: " << context.evaluate(storeProgram) << endl;
+			cout << "Should be: 225" << endl;
+		}
+
+		try
+		{
+			store.loadFromFile("not_a_file.txt");
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Could not open file: not_a_file.txt" << endl;
+		cout << "Version after failed load: " << store.getVersion() << endl;
+		cout << "Should be: 201" << endl;
+	}
+	cout << endl;
+
+	cout << "=== Async Evaluation Service ===" << endl;
+	{
+		AsyncEvaluationService service(2, 4);
+		CompiledExpression::VariableArray serviceValues = { 5, 10, 15, 20, 25, 30 };
+
+		vector<future<double>> pending;
+		for (int i = 0; i < 16; ++i)
+		{
+			pending.push_back(service.submit("a*(b+c)*(d-e)+f", serviceValues));
+		}
+		bool allMatch = true;
+		for (future<double>& result : pending)
+		{
+			allMatch = allMatch && result.get() == -595;
+		}
+		cout << "Sixteen futures all -595: " << (allMatch ? "yes" : "no") << endl;
+		cout << "Should be: yes" << endl;
+
+		future<double> failing = service.submit("a/(b-b)", serviceValues);
+		try
+		{
+			failing.get();
+		}
+		catch (const runtime_error& e)
+		{
+			cout << "Error: " << e.what() << endl;
+		}
+		cout << "Should be: Error: Division by zero" << endl;
+
+		// A throwing callback is contained, and the worker keeps serving requests. One worker keeps the two requests in order
+		{
+			AsyncEvaluationService callbackService(1);
+			callbackService.submit("a+b", serviceValues, [](double, std::exception_ptr) { throw runtime_error("Callback failed"); });
+			cout << "Served after a throwing callback: " << callbackService.submit("a+b", serviceValues).get()
+				<< " callback failures: " << callbackService.getCallbackFailureCount() << endl;
+		}
+		cout << "Should be: Served after a throwing callback: 15 callback failures: 1" << endl;
+
+#ifdef ASYNC_EVALUATION_COROUTINES
+		promise<string> awaited;
+		future<string> awaitedResult = awaited.get_future();
+		awaitEvaluation(service, "(a+b)*c", serviceValues, awaited);
+		cout << "Awaited result: " << awaitedResult.get() << endl;
+		cout << "Should be: Awaited result: 225" << endl;
+#endif
+	}  // The destructor drains the queue and joins the workers
+	cout << endl;
+
 	// User testing interface
 	cout << "=== User Input Testing InfixToPostfixEvaluation ===" << endl;
 
@@ -0,0 +1,285 @@
+/** @file Tracer.cpp
+ * Tracer records spans and opcode counts into per-thread ring buffers and exports them as Chrome trace JSON.
+ * @class Tracer
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "Tracer.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+Tracer::Span::Span(const char* spanName) noexcept : name(nullptr), startNanoseconds(0)
+{
+    if (Tracer::isEnabled())
+    {
+        name = spanName;
+        startNanoseconds = Tracer::now();
+    }
+} // end constructor
+
+Tracer::Span::~Span()
+{
+    if (name != nullptr)
+    {
+        Tracer::recordSpan(name, startNanoseconds, Tracer::now() - startNanoseconds);
+    }
+} // end destructor
+
+Tracer::Registry& Tracer::registry()
+{
+    static Registry threadRegistry;
+    return threadRegistry;
+} // end registry
+
+std::atomic<bool>& Tracer::enabledFlag() noexcept
+{
+    static std::atomic<bool> enabled{ false };
+    return enabled;
+} // end enabledFlag
+
+Tracer::ThreadBufferOwner::~ThreadBufferOwner()
+{
+    if (!buffer)
+    {
+        return;
+    }
+    Registry& threadRegistry = registry();
+    std::lock_guard<std::mutex> lock(threadRegistry.registryMutex);
+    buffer->retired = true;
+    if (buffer->writeIndex.load(std::memory_order_relaxed) == buffer->exportedIndex)
+    {
+        // Nothing left to export, so the ring buffer can go now
+        for (size_t i = 0; i < threadRegistry.buffers.size(); ++i)
+        {
+            if (threadRegistry.buffers[i] == buffer)
+            {
+                releaseBuffer(threadRegistry, i);
+                break;
+            }
+        }
+    }
+} // end destructor
+
+void Tracer::releaseBuffer(Registry& threadRegistry, size_t position)
+{
+    const ThreadBuffer& buffer = *threadRegistry.buffers[position];
+    for (size_t i = 0; i < OPCODE_COUNT; ++i)
+    {
+        threadRegistry.retiredOpcodeCounts[i] += buffer.opcodeCounts[i].load(std::memory_order_relaxed);
+    }
+    threadRegistry.buffers.erase(threadRegistry.buffers.begin() + position);
+} // end releaseBuffer
+
+Tracer::ThreadBuffer& Tracer::threadBuffer()
+{
+    thread_local ThreadBufferOwner owner;
+    if (!owner.buffer)
+    {
+        // Registration is the only step that locks, and happens once per thread
+        owner.buffer = std::make_shared<ThreadBuffer>();
+        Registry& threadRegistry = registry();
+        std::lock_guard<std::mutex> lock(threadRegistry.registryMutex);
+        owner.buffer->threadId = threadRegistry.nextThreadId++;
+        threadRegistry.buffers.push_back(owner.buffer);
+    }
+    return *owner.buffer;
+} // end threadBuffer
+
+std::uint64_t Tracer::now() noexcept
+{
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch).count());
+} // end now
+
+void Tracer::enable() noexcept
+{
+    now();  // Fix the epoch before the first span
+    enabledFlag().store(true, std::memory_order_relaxed);
+} // end enable
+
+void Tracer::disable() noexcept
+{
+    enabledFlag().store(false, std::memory_order_relaxed);
+} // end disable
+
+bool Tracer::isEnabled() noexcept
+{
+    return enabledFlag().load(std::memory_order_relaxed);
+} // end isEnabled
+
+void Tracer::recordSpan(const char* name, std::uint64_t startNanoseconds, std::uint64_t durationNanoseconds)
+{
+    ThreadBuffer& buffer = threadBuffer();
+    std::uint64_t index = buffer.writeIndex.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer.events[index % RING_CAPACITY];
+
+    // Order the earlier publication of writeIndex before the overwrite, so an export that reads a new field also sees the slot as reused
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.startNanoseconds.store(startNanoseconds, std::memory_order_relaxed);
+    event.durationNanoseconds.store(durationNanoseconds, std::memory_order_relaxed);
+    buffer.writeIndex.store(index + 1, std::memory_order_release);  // Publish the event
+} // end recordSpan
+
+size_t Tracer::opcodeIndex(char token) noexcept
+{
+    switch (token)
+    {
+    case '+': return static_cast<size_t>(CompiledExpression::Opcode::Add);
+    case '-': return static_cast<size_t>(CompiledExpression::Opcode::Subtract);
+    case '*': return static_cast<size_t>(CompiledExpression::Opcode::Multiply);
+    case '/': return static_cast<size_t>(CompiledExpression::Opcode::Divide);
+    default:
+        if (token >= 'a' && token < 'a' + static_cast<int>(CompiledExpression::VARIABLE_CAPACITY))
+        {
+            return static_cast<size_t>(token - 'a');
+        }
+        return OPCODE_COUNT;
+    }
+} // end opcodeIndex
+
+void Tracer::recordOpcodes(const OpcodeHistogram& counts)
+{
+    ThreadBuffer& buffer = threadBuffer();
+    for (size_t i = 0; i < OPCODE_COUNT; ++i)
+    {
+        if (counts[i] != 0)
+        {
+            // Only the owning thread writes, so a load and store is enough
+            buffer.opcodeCounts[i].store(buffer.opcodeCounts[i].load(std::memory_order_relaxed) + counts[i],
+                std::memory_order_relaxed);
+        }
+    }
+} // end recordOpcodes
+
+void Tracer::recordBytecode(const std::vector<std::uint8_t>& bytecode)
+{
+    OpcodeHistogram counts{};
+    for (std::uint8_t instruction : bytecode)
+    {
+        ++counts[instruction];
+    }
+    recordOpcodes(counts);
+} // end recordBytecode
+
+Tracer::OpcodeHistogram Tracer::getOpcodeHistogram()
+{
+    Registry& threadRegistry = registry();
+    std::lock_guard<std::mutex> lock(threadRegistry.registryMutex);
+    OpcodeHistogram histogram = threadRegistry.retiredOpcodeCounts;
+    for (const std::shared_ptr<ThreadBuffer>& entry : threadRegistry.buffers)
+    {
+        const ThreadBuffer& buffer = *entry;
+        for (size_t i = 0; i < OPCODE_COUNT; ++i)
+        {
+            histogram[i] += buffer.opcodeCounts[i].load(std::memory_order_relaxed);
+        }
+    }
+    return histogram;
+} // end getOpcodeHistogram
+
+std::string Tracer::exportChromeTrace()
+{
+    static const char* const opcodeNames[OPCODE_COUNT] =
+    {
+        "loadA", "loadB", "loadC", "loadD", "loadE", "loadF", "add", "subtract", "multiply", "divide"
+    };
+
+    std::string json = "{\"traceEvents\":[";
+    bool firstEvent = true;
+    char field[96];
+
+    {
+        Registry& threadRegistry = registry();
+        std::lock_guard<std::mutex> lock(threadRegistry.registryMutex);
+        for (size_t position = 0; position < threadRegistry.buffers.size();)
+        {
+            ThreadBuffer& buffer = *threadRegistry.buffers[position];
+            std::uint64_t endIndex = buffer.writeIndex.load(std::memory_order_acquire);
+            std::uint64_t beginIndex = endIndex > RING_CAPACITY ? endIndex - RING_CAPACITY : 0;
+
+            for (std::uint64_t index = beginIndex; index < endIndex; ++index)
+            {
+                const TraceEvent& event = buffer.events[index % RING_CAPACITY];
+                const char* name = event.name.load(std::memory_order_relaxed);
+                std::uint64_t start = event.startNanoseconds.load(std::memory_order_relaxed);
+                std::uint64_t duration = event.durationNanoseconds.load(std::memory_order_relaxed);
+
+                // Skip slots the owning thread began overwriting while they were being read. The slot is reused as soon
+                // as writeIndex reaches index + RING_CAPACITY, and the fence keeps the recheck after the field loads
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (buffer.writeIndex.load(std::memory_order_relaxed) >= index + RING_CAPACITY)
+                {
+                    continue;
+                }
+
+                json += firstEvent ? "{\"name\":\"" : ",{\"name\":\"";
+                json += name;
+                std::snprintf(field, sizeof(field), "\",\"cat\":\"postfix\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                    start / 1000.0, duration / 1000.0);
+                json += field;
+                json += ",\"pid\":1,\"tid\":" + std::to_string(buffer.threadId) + "}";
+                firstEvent = false;
+            }
+
+            // A thread that has exited will record nothing more, so its buffer is released once exported
+            buffer.exportedIndex = endIndex;
+            if (buffer.retired)
+            {
+                releaseBuffer(threadRegistry, position);
+            }
+            else
+            {
+                ++position;
+            }
+        }
+    }
+
+    // The opcode histogram is exported as a single counter sample
+    OpcodeHistogram histogram = getOpcodeHistogram();
+    json += firstEvent ? "" : ",";
+    json += "{\"name\":\"opcodeHistogram\",\"ph\":\"C\",\"ts\":" + std::to_string(now() / 1000) + ",\"pid\":1,\"args\":{";
+    for (size_t i = 0; i < OPCODE_COUNT; ++i)
+    {
+        json += (i == 0 ? "\"" : ",\"") + std::string(opcodeNames[i]) + "\":" + std::to_string(histogram[i]);
+    }
+    json += "}}]}";
+    return json;
+} // end exportChromeTrace
+
+void Tracer::writeChromeTrace(const std::string& filename)
+{
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    file << exportChromeTrace();
+    if (!file)
+    {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+} // end writeChromeTrace
+
+void Tracer::reset() noexcept
+{
+    Registry& threadRegistry = registry();
+    std::lock_guard<std::mutex> lock(threadRegistry.registryMutex);
+    std::erase_if(threadRegistry.buffers, [](const std::shared_ptr<ThreadBuffer>& entry) { return entry->retired; });
+    threadRegistry.retiredOpcodeCounts = {};
+    for (const std::shared_ptr<ThreadBuffer>& entry : threadRegistry.buffers)
+    {
+        ThreadBuffer& buffer = *entry;
+        buffer.writeIndex.store(0, std::memory_order_relaxed);
+        buffer.exportedIndex = 0;
+        for (std::atomic<std::uint64_t>& count : buffer.opcodeCounts)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+} // end reset
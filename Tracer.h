@@ -0,0 +1,190 @@
+/** @file Tracer.h
+ * @class Tracer
+ * Optional tracing of conversion, evaluation, and file loading. Spans are recorded into a fixed-size ring buffer owned by each thread without locking, and can be exported as Chrome trace JSON (chrome://tracing or Perfetto). Evaluation also counts executed opcodes into a per-thread histogram. When tracing is disabled, a span costs a single relaxed atomic load.
+ */
+
+#ifndef TRACER_
+#define TRACER_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "CompiledExpression.h"
+
+class Tracer
+{
+public:
+    /** Number of spans each thread keeps. Older spans are overwritten. */
+    static constexpr size_t RING_CAPACITY = 4096;
+
+    /** Number of opcodes in the histogram, LoadA through Divide. */
+    static constexpr size_t OPCODE_COUNT = 10;
+
+    /** Executed instruction counts, indexed by CompiledExpression::Opcode. */
+    using OpcodeHistogram = std::array<std::uint64_t, OPCODE_COUNT>;
+
+    /** RAII span that records its lifetime when tracing is enabled. */
+    class Span
+    {
+    private:
+        /** Name of the span, or nullptr if tracing was disabled when the span began. */
+        const char* name;
+
+        /** Start time in nanoseconds since the tracer epoch. */
+        std::uint64_t startNanoseconds;
+
+    public:
+        /** Begins a span.
+         * @param spanName A string literal naming the span. */
+        explicit Span(const char* spanName) noexcept;
+
+        /** Spans cannot be copied. */
+        Span(const Span&) = delete;
+
+        /** Spans cannot be copied. */
+        Span& operator=(const Span&) = delete;
+
+        /** Ends the span and records it. */
+        ~Span();
+    };
+
+private:
+    /** A recorded span. Fields are atomic so an export can run while the owning thread records. */
+    struct TraceEvent
+    {
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<std::uint64_t> startNanoseconds{ 0 };
+        std::atomic<std::uint64_t> durationNanoseconds{ 0 };
+    };
+
+    /** Ring buffer and opcode counts written only by their owning thread. */
+    struct ThreadBuffer
+    {
+        std::uint32_t threadId = 0;
+        std::atomic<std::uint64_t> writeIndex{ 0 };
+        std::array<TraceEvent, RING_CAPACITY> events;
+        std::array<std::atomic<std::uint64_t>, OPCODE_COUNT> opcodeCounts{};
+
+        /** writeIndex at the last export. Guarded by the registry mutex. */
+        std::uint64_t exportedIndex = 0;
+
+        /** True once the owning thread has exited. Guarded by the registry mutex. */
+        bool retired = false;
+    };
+
+    /** Owns the calling thread's buffer and retires it when the thread exits. */
+    struct ThreadBufferOwner
+    {
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        /** Releases the buffer if every span in it has been exported, otherwise leaves it for the next export to release. */
+        ~ThreadBufferOwner();
+    };
+
+    /** The buffers of running threads, and of exited threads whose spans have not been exported yet. */
+    struct Registry
+    {
+        std::mutex registryMutex;
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+        /** Opcode counts of threads whose buffers were released. */
+        OpcodeHistogram retiredOpcodeCounts{};
+
+        /** Identifier for the next registered thread. */
+        std::uint32_t nextThreadId = 1;
+    };
+
+    /** Helper function to release a buffer that is no longer needed, keeping its opcode counts.
+     * @pre The registry mutex is held and the buffer's thread has exited.
+     * @post The buffer is removed from the registry.
+     * @param threadRegistry The registry.
+     * @param position The position of the buffer in the registry. */
+    static void releaseBuffer(Registry& threadRegistry, size_t position);
+
+    /** Helper function to access the registry of thread buffers. */
+    static Registry& registry();
+
+    /** Helper function to access the global enabled flag. */
+    static std::atomic<bool>& enabledFlag() noexcept;
+
+    /** Helper function to access the buffer of the calling thread, registering it on first use. */
+    static ThreadBuffer& threadBuffer();
+
+    /** Helper function to read the monotonic clock in nanoseconds since the tracer epoch. */
+    static std::uint64_t now() noexcept;
+
+public:
+    /** Starts recording spans and opcode counts.
+     * @pre None
+     * @post Tracing is enabled on every thread. */
+    static void enable() noexcept;
+
+    /** Stops recording spans and opcode counts. Recorded data is kept.
+     * @pre None
+     * @post Tracing is disabled on every thread. */
+    static void disable() noexcept;
+
+    /** Sees whether tracing is enabled.
+     * @pre None
+     * @post None
+     * @return True if tracing is enabled, or false if not. */
+    static bool isEnabled() noexcept;
+
+    /** Records a completed span in the calling thread's ring buffer.
+     * @pre name is a string literal.
+     * @post The span is in the ring buffer, replacing the oldest span if it is full.
+     * @param name The name of the span.
+     * @param startNanoseconds Start time in nanoseconds since the tracer epoch.
+     * @param durationNanoseconds Duration in nanoseconds. */
+    static void recordSpan(const char* name, std::uint64_t startNanoseconds, std::uint64_t durationNanoseconds);
+
+    /** Maps a postfix token to its histogram slot.
+     * @pre None
+     * @post None
+     * @param token A variable a-f or an operator +,-,*,/.
+     * @return The CompiledExpression::Opcode of the token, or OPCODE_COUNT for any other character. */
+    static size_t opcodeIndex(char token) noexcept;
+
+    /** Adds executed instruction counts to the calling thread's histogram.
+     * @pre None
+     * @post The counts are added to the histogram.
+     * @param counts Instruction counts indexed by CompiledExpression::Opcode. */
+    static void recordOpcodes(const OpcodeHistogram& counts);
+
+    /** Adds the instructions of a bytecode stream to the calling thread's histogram.
+     * @pre None
+     * @post The counts are added to the histogram.
+     * @param bytecode The bytecode that was executed. */
+    static void recordBytecode(const std::vector<std::uint8_t>& bytecode);
+
+    /** Retrieves the opcode histogram summed over all threads.
+     * @pre None
+     * @post None
+     * @return Executed instruction counts indexed by CompiledExpression::Opcode. */
+    static OpcodeHistogram getOpcodeHistogram();
+
+    /** Exports every recorded span and the opcode histogram as Chrome trace JSON.
+     * @pre None
+     * @post Recorded data is unchanged, except that the buffers of threads that have exited are released now that their spans are exported.
+     * @return The trace as a JSON string. */
+    static std::string exportChromeTrace();
+
+    /** Writes the Chrome trace JSON to a file.
+     * @pre None
+     * @post The file holds the trace, replacing any previous contents.
+     * @param filename The name of the file to write.
+     * @throw std::runtime_error If the file cannot be written. */
+    static void writeChromeTrace(const std::string& filename);
+
+    /** Discards every recorded span and opcode count.
+     * @pre No thread is recording.
+     * @post All ring buffers and histograms are empty. */
+    static void reset() noexcept;
+};
+
+#include "Tracer.cpp"
+#endif
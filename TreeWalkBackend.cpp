@@ -0,0 +1,61 @@
+/** @file TreeWalkBackend.cpp
+ * TreeWalkBackend evaluates the expression tree of a compiled expression.
+ * @class TreeWalkBackend
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "TreeWalkBackend.h"
+
+double TreeWalkBackend::evaluateNode(const std::vector<CompiledExpression::AstNode>& arena, int nodeIndex,
+    const CompiledExpression::VariableArray& variableValues, std::pmr::memory_resource* resource)
+{
+    // A node is pushed once to schedule its operands and once more to combine their values
+    struct PendingNode
+    {
+        int nodeIndex;
+        bool operandsEvaluated;
+    };
+    std::pmr::vector<PendingNode> pendingNodes(resource);
+    std::pmr::vector<double> operandValues(resource);
+    pendingNodes.push_back({ nodeIndex, false });
+
+    while (!pendingNodes.empty())
+    {
+        PendingNode pending = pendingNodes.back();
+        pendingNodes.pop_back();
+        const CompiledExpression::AstNode& node = arena[pending.nodeIndex];
+
+        if (node.left < 0)  // Leaf holding a variable
+        {
+            operandValues.push_back(variableValues[node.token - 'a']);
+        }
+        else if (!pending.operandsEvaluated)
+        {
+            // The left operand is pushed last so it is evaluated first and errors surface in postfix order
+            pendingNodes.push_back({ pending.nodeIndex, true });
+            pendingNodes.push_back({ node.right, false });
+            pendingNodes.push_back({ node.left, false });
+        }
+        else
+        {
+            double operand2 = operandValues.back();
+            operandValues.pop_back();
+            operandValues.back() = CompiledExpression::applyOperator(node.token, operandValues.back(), operand2);
+        }
+    }
+
+    return operandValues.back();
+} // end evaluateNode
+
+double TreeWalkBackend::execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+    std::pmr::memory_resource* resource) const
+{
+    return evaluateNode(expression.getAstArena(), expression.getAstRoot(), variableValues, resource);
+} // end execute
+
+std::string TreeWalkBackend::getName() const
+{
+    return "tree-walk";
+} // end getName
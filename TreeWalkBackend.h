@@ -0,0 +1,45 @@
+/** @file TreeWalkBackend.h
+ * @class TreeWalkBackend
+ * Execution backend that walks the flat, arena-allocated expression tree of a compiled expression in post-order.
+ * The walk keeps its pending nodes on an explicit stack, so deep trees such as long left-deep chains cannot overflow the call stack.
+ */
+
+#ifndef TREE_WALK_BACKEND_
+#define TREE_WALK_BACKEND_
+
+#include "ExecutionBackendInterface.h"
+
+class TreeWalkBackend : public ExecutionBackendInterface
+{
+private:
+    /** Helper function to evaluate the subtree rooted at a node, visiting operands left to right.
+     * @pre nodeIndex is a valid arena index.
+     * @post None
+     * @param arena The arena holding the expression tree.
+     * @param nodeIndex The arena index of the subtree root.
+     * @param variableValues The values of variables a-f.
+     * @param resource Memory resource the pending-node and operand stacks allocate from.
+     * @return The value of the subtree.
+     * @throws std::runtime_error If division by zero occurs. */
+    static double evaluateNode(const std::vector<CompiledExpression::AstNode>& arena, int nodeIndex,
+        const CompiledExpression::VariableArray& variableValues, std::pmr::memory_resource* resource);
+
+public:
+    /** Evaluates a compiled expression by walking its expression tree.
+     * @pre None
+     * @post The expression and variable values are unchanged.
+     * @param expression The compiled expression to evaluate.
+     * @param variableValues The values of variables a-f.
+     * @param resource Memory resource the walk's pending-node and operand stacks allocate from.
+     * @return The result of the evaluation as a floating point number.
+     * @throws std::runtime_error If division by zero occurs. */
+    double execute(const CompiledExpression& expression, const CompiledExpression::VariableArray& variableValues,
+        std::pmr::memory_resource* resource) const override;
+
+    /** Retrieves the name of this backend.
+     * @return "tree-walk" */
+    std::string getName() const override;
+};
+
+#include "TreeWalkBackend.cpp"
+#endif
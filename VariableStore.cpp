@@ -0,0 +1,161 @@
+/** @file VariableStore.cpp
+ * VariableStore publishes variable values as immutable snapshots that readers pin without locking.
+ * @class VariableStore
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include "VariableStore.h"
+#include <fstream>
+
+VariableStore::Reader::Reader(VariableStore& owner) noexcept : store(owner), epochParity(0), snapshot(nullptr)
+{
+    // Register under the current epoch, then confirm it did not flip before the registration was visible.
+    // A publish flips the epoch after swapping the pointer, so a reader that passes this check loads either
+    // the newest snapshot or one its writer is still waiting on.
+    while (true)
+    {
+        std::uint64_t epoch = store.readerEpoch.load();
+        epochParity = static_cast<size_t>(epoch & 1);
+        store.activeReaders[epochParity].fetch_add(1);
+        if (store.readerEpoch.load() == epoch)
+        {
+            break;
+        }
+        store.activeReaders[epochParity].fetch_sub(1);
+    }
+    snapshot = store.currentSnapshot.load();
+} // end constructor
+
+VariableStore::Reader::~Reader()
+{
+    store.activeReaders[epochParity].fetch_sub(1, std::memory_order_release);
+} // end destructor
+
+const CompiledExpression::VariableArray& VariableStore::Reader::values() const noexcept
+{
+    return snapshot->values;
+} // end values
+
+std::uint64_t VariableStore::Reader::version() const noexcept
+{
+    return snapshot->version;
+} // end version
+
+VariableStore::VariableStore()
+    : currentSnapshot(new Snapshot{ {}, 0 }), readerEpoch(0), reloadFailures(0), stopRequested(false)
+{
+    activeReaders[0] = 0;
+    activeReaders[1] = 0;
+} // end default constructor
+
+VariableStore::VariableStore(const std::string& filename)
+    : currentSnapshot(new Snapshot{ readValues(filename), 0 }), readerEpoch(0), reloadFailures(0), stopRequested(false)
+{
+    activeReaders[0] = 0;
+    activeReaders[1] = 0;
+} // end constructor
+
+VariableStore::~VariableStore()
+{
+    stopReloading();
+    delete currentSnapshot.load();
+} // end destructor
+
+CompiledExpression::VariableArray VariableStore::readValues(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    // Parse into a local array so a short file never produces a half-written variable set
+    CompiledExpression::VariableArray values;
+    for (int& value : values)
+    {
+        if (!(file >> value))
+        {
+            throw std::runtime_error("File does not contain enough values.");
+        }
+    }
+    return values;
+} // end readValues
+
+void VariableStore::publish(const CompiledExpression::VariableArray& values)
+{
+    std::lock_guard<std::mutex> lock(writerMutex);
+
+    const Snapshot* previous = currentSnapshot.load();
+    const Snapshot* replacement = new Snapshot{ values, previous->version + 1 };
+    currentSnapshot.store(replacement);
+
+    // Move new readers to the other counter, then wait for the readers that may have loaded previous
+    std::uint64_t oldEpoch = readerEpoch.fetch_add(1);
+    std::atomic<size_t>& oldReaders = activeReaders[static_cast<size_t>(oldEpoch & 1)];
+    while (oldReaders.load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    delete previous;
+} // end publish
+
+void VariableStore::loadFromFile(const std::string& filename)
+{
+    publish(readValues(filename));
+} // end loadFromFile
+
+void VariableStore::startReloading(const std::string& filename, std::chrono::milliseconds interval)
+{
+    if (reloadThread.joinable())
+    {
+        throw std::logic_error("Background reloading is already running");
+    }
+
+    stopRequested = false;
+    reloadThread = std::thread([this, filename, interval]
+        {
+            std::unique_lock<std::mutex> lock(reloadMutex);
+            while (!reloadWakeup.wait_for(lock, interval, [this] { return stopRequested; }))
+            {
+                lock.unlock();
+                try
+                {
+                    loadFromFile(filename);
+                }
+                catch (const std::runtime_error&)
+                {
+                    reloadFailures.fetch_add(1, std::memory_order_relaxed);  // Keep serving the last good snapshot
+                }
+                lock.lock();
+            }
+        });
+} // end startReloading
+
+void VariableStore::stopReloading()
+{
+    if (!reloadThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(reloadMutex);
+        stopRequested = true;
+    }
+    reloadWakeup.notify_all();
+    reloadThread.join();
+} // end stopReloading
+
+std::uint64_t VariableStore::getVersion() noexcept
+{
+    Reader reader(*this);
+    return reader.version();
+} // end getVersion
+
+size_t VariableStore::getReloadFailureCount() const noexcept
+{
+    return reloadFailures.load(std::memory_order_relaxed);
+} // end getReloadFailureCount
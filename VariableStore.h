@@ -0,0 +1,160 @@
+/** @file VariableStore.h
+ * @class VariableStore
+ * Holds the current variable values as an immutable snapshot that can be replaced while evaluations are running. Readers pin the current snapshot with a Reader, which costs two atomic operations and never blocks. A writer builds a complete new snapshot, publishes it with one atomic pointer swap, then waits for every reader that might still hold the old snapshot before deleting it, in the style of read-copy-update. The store can reload a variable file periodically on a background thread.
+ */
+
+#ifndef VARIABLE_STORE_
+#define VARIABLE_STORE_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "CompiledExpression.h"
+
+class VariableStore
+{
+public:
+    /** One published set of variable values. Never modified after it is published. */
+    struct Snapshot
+    {
+        /** The values of variables a-f. */
+        CompiledExpression::VariableArray values;
+
+        /** Number of snapshots published before this one. */
+        std::uint64_t version;
+    };
+
+private:
+    /** The snapshot new readers pin. */
+    std::atomic<const Snapshot*> currentSnapshot;
+
+    /** Selects which reader counter new readers register in. Flipped by every publish. */
+    std::atomic<std::uint64_t> readerEpoch;
+
+    /** Number of active readers registered in each epoch parity. */
+    std::array<std::atomic<size_t>, 2> activeReaders;
+
+    /** Serializes writers. Readers never take it. */
+    std::mutex writerMutex;
+
+    /** Number of background reloads that failed and left the snapshot unchanged. */
+    std::atomic<size_t> reloadFailures;
+
+    /** Background reload thread, if running. */
+    std::thread reloadThread;
+
+    /** Guards stopRequested for the reload thread. */
+    std::mutex reloadMutex;
+
+    /** Wakes the reload thread early when it should stop. */
+    std::condition_variable reloadWakeup;
+
+    /** True when the reload thread should exit. */
+    bool stopRequested;
+
+    /** Helper function to read variable values without touching the published snapshot.
+     * @pre None
+     * @post File is unchanged.
+     * @param filename The name of the file containing variable values.
+     * @return The values read.
+     * @throw std::runtime_error If the file cannot be opened or does not contain enough values. */
+    static CompiledExpression::VariableArray readValues(const std::string& filename);
+
+public:
+    /** Pins the current snapshot for as long as the reader exists. */
+    class Reader
+    {
+    private:
+        VariableStore& store;
+        size_t epochParity;
+        const Snapshot* snapshot;
+
+    public:
+        /** Pins the current snapshot without blocking.
+         * @pre None
+         * @post The pinned snapshot stays valid until the reader is destroyed. */
+        explicit Reader(VariableStore& owner) noexcept;
+
+        /** Readers cannot be copied. */
+        Reader(const Reader&) = delete;
+
+        /** Readers cannot be copied. */
+        Reader& operator=(const Reader&) = delete;
+
+        /** Releases the pinned snapshot. */
+        ~Reader();
+
+        /** Retrieves the pinned variable values.
+         * @return The values of variables a-f. */
+        const CompiledExpression::VariableArray& values() const noexcept;
+
+        /** Retrieves the version of the pinned snapshot.
+         * @return The number of snapshots published before it. */
+        std::uint64_t version() const noexcept;
+    };
+
+    /** Creates a store whose first snapshot has every variable set to 0.
+     * @pre None
+     * @post A version 0 snapshot is published. */
+    VariableStore();
+
+    /** Creates a store whose first snapshot is read from a file.
+     * @pre None
+     * @post A version 0 snapshot is published.
+     * @param filename The name of the file containing variable values.
+     * @throw std::runtime_error If the file cannot be opened or does not contain enough values. */
+    explicit VariableStore(const std::string& filename);
+
+    /** The store cannot be copied. */
+    VariableStore(const VariableStore&) = delete;
+
+    /** The store cannot be copied. */
+    VariableStore& operator=(const VariableStore&) = delete;
+
+    /** Stops background reloading and deletes the current snapshot.
+     * @pre No Reader is alive. */
+    ~VariableStore();
+
+    /** Publishes a new snapshot.
+     * @pre The calling thread holds no Reader on this store.
+     * @post New readers see values. Returns once no reader can still see the previous snapshot, which has been deleted.
+     * @param values The values of variables a-f. */
+    void publish(const CompiledExpression::VariableArray& values);
+
+    /** Reads a variable file and publishes it as a new snapshot.
+     * @pre The calling thread holds no Reader on this store.
+     * @post The file's values are published. The current snapshot is unchanged if reading fails.
+     * @param filename The name of the file containing variable values.
+     * @throw std::runtime_error If the file cannot be opened or does not contain enough values. */
+    void loadFromFile(const std::string& filename);
+
+    /** Starts reloading a variable file periodically on a background thread. Failed reloads keep the current snapshot.
+     * @pre Background reloading is not running.
+     * @post The file is reloaded every interval until stopReloading is called.
+     * @param filename The name of the file containing variable values.
+     * @param interval The time between reloads. */
+    void startReloading(const std::string& filename, std::chrono::milliseconds interval);
+
+    /** Stops background reloading.
+     * @pre None
+     * @post The reload thread has exited. */
+    void stopReloading();
+
+    /** Retrieves the version of the current snapshot.
+     * @pre None
+     * @return The number of snapshots published before it. */
+    std::uint64_t getVersion() noexcept;
+
+    /** Retrieves the number of background reloads that failed.
+     * @return The failure count. */
+    size_t getReloadFailureCount() const noexcept;
+};
+
+#include "VariableStore.cpp"
+#endif
@@ -0,0 +1,267 @@
+/** @file WorkloadReplay.cpp
+ * Command line tool that replays a recorded workload against InfixToPostfixEvaluation and reports throughput and latency percentiles.
+ * Each workload line is an infix expression and the six variable values to evaluate it with: (a+b)*c | 5 10 15 20 25 30
+ * Without --rate, every thread issues requests back to back (closed loop). With --rate, requests are scheduled at a fixed total
+ * arrival rate (open loop). A thread that is on time sleeps until just before the scheduled start and spins the rest of the way, so timer
+ * slack is not reported as latency. A thread that is behind schedule measures total latency from the scheduled start, so time spent
+ * behind schedule is counted. The lateness of every start is reported as its own "lag" row.
+ * Usage: WorkloadReplay <workload.txt> [--threads N] [--requests N] [--rate requests-per-second]
+ * @author Stephen Wagner
+ * @date 10/19/2026
+ * CSCI 591 Section 1
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include "InfixToPostfixEvaluation.h"
+#include "LatencyHistogram.h"
+
+using namespace std;
+
+/** One recorded request. */
+struct WorkloadEntry
+{
+	string infixExpression;
+	CompiledExpression::VariableArray variableValues;
+};
+
+/** Latencies and failures recorded by one replay thread. */
+struct ReplayResults
+{
+	LatencyHistogram convertLatency;
+	LatencyHistogram evaluateLatency;
+	LatencyHistogram totalLatency;
+	LatencyHistogram scheduleLag;
+	size_t failures = 0;
+};
+
+/** How long before a scheduled start a thread stops sleeping and spins, which covers the wake-up overshoot of sleep_until. */
+const chrono::microseconds SPIN_WINDOW(100);
+
+/** Returns the nanoseconds between two time points. */
+uint64_t elapsedNanoseconds(chrono::steady_clock::time_point from, chrono::steady_clock::time_point to)
+{
+	return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(to - from).count());
+}
+
+/** Returns true if every closing parenthesis has an opening one, which convertInfixToPostfix requires. */
+bool parenthesesBalanced(const string& infixExpr)
+{
+	int depth = 0;
+	for (char currentChar : infixExpr)
+	{
+		depth += currentChar == '(' ? 1 : currentChar == ')' ? -1 : 0;
+		if (depth < 0)
+		{
+			return false;
+		}
+	}
+	return depth == 0;
+}
+
+/** Prints one row of the latency table. */
+void printLatencyRow(const string& phase, const LatencyHistogram& histogram)
+{
+	cout << left << setw(10) << phase << right
+		<< setw(12) << histogram.getValueAtPercentile(50)
+		<< setw(12) << histogram.getValueAtPercentile(99)
+		<< setw(12) << histogram.getValueAtPercentile(99.9)
+		<< setw(12) << histogram.getMax()
+		<< setw(12) << fixed << setprecision(0) << histogram.getMean() << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argc % 2 != 0)
+	{
+		cerr << "Usage: " << argv[0] << " <workload.txt> [--threads N] [--requests N] [--rate requests-per-second]" << endl;
+		return 1;
+	}
+
+	size_t threadCount = max(1u, thread::hardware_concurrency());
+	size_t requestCount = 100000;
+	double arrivalRate = 0;  // Requests per second across all threads, 0 for closed loop
+	for (int i = 2; i < argc; i += 2)
+	{
+		string option = argv[i];
+		try
+		{
+			if (option == "--threads") threadCount = max<size_t>(1, stoul(argv[i + 1]));
+			else if (option == "--requests") requestCount = stoul(argv[i + 1]);
+			else if (option == "--rate") arrivalRate = stod(argv[i + 1]);
+			else
+			{
+				cerr << "Unknown option: " << option << endl;
+				return 1;
+			}
+		}
+		catch (const std::exception&)
+		{
+			cerr << "Invalid value for " << option << ": " << argv[i + 1] << endl;
+			return 1;
+		}
+	}
+
+	ifstream workloadFile(argv[1]);
+	if (!workloadFile)
+	{
+		cerr << "Could not open file: " << argv[1] << endl;
+		return 1;
+	}
+
+	// Load and check the whole workload before replaying any of it
+	vector<WorkloadEntry> workload;
+	InfixToPostfixEvaluation checker;
+	string line;
+	size_t lineNumber = 0;
+	size_t loadFailures = 0;
+	while (getline(workloadFile, line))
+	{
+		++lineNumber;
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();  // Accept files with Windows line endings
+		}
+		size_t firstChar = line.find_first_not_of(" \t");
+		if (firstChar == string::npos || line[firstChar] == '#')
+		{
+			continue;  // Skip blank lines and comments
+		}
+
+		WorkloadEntry entry;
+		size_t separator = line.find('|');
+		entry.infixExpression = line.substr(0, separator);
+		istringstream values(separator == string::npos ? string() : line.substr(separator + 1));
+		bool valuesRead = true;
+		for (int& value : entry.variableValues)
+		{
+			valuesRead = valuesRead && static_cast<bool>(values >> value);
+		}
+
+		try
+		{
+			if (!valuesRead) throw std::runtime_error("Line does not contain six variable values");
+			if (!parenthesesBalanced(entry.infixExpression)) throw std::runtime_error("Unbalanced parentheses");
+			checker.convertInfixToPostfix(entry.infixExpression);
+			checker.compilePostfixExpression();
+			workload.push_back(entry);
+		}
+		catch (const std::runtime_error& error)
+		{
+			cerr << argv[1] << ":" << lineNumber << ": " << error.what() << ": " << line << endl;
+			++loadFailures;
+		}
+	}
+
+	if (loadFailures > 0 || workload.empty())
+	{
+		cerr << (workload.empty() ? "Workload is empty." : "Workload has invalid lines, nothing replayed.") << endl;
+		return 1;
+	}
+
+	// Thread t replays requests t, t + threadCount, ... so the workload mix is the same on every thread
+	vector<ReplayResults> threadResults(threadCount);
+	chrono::nanoseconds requestInterval(arrivalRate > 0 ? static_cast<long long>(1e9 / arrivalRate) : 0);
+	chrono::steady_clock::time_point replayStart = chrono::steady_clock::now();
+	if (arrivalRate > 0)
+	{
+		replayStart += chrono::milliseconds(10);  // Give every thread time to start before the first arrival
+	}
+
+	auto replay = [&](size_t threadIndex)
+		{
+			InfixToPostfixEvaluation evaluator;
+			ReplayResults& results = threadResults[threadIndex];
+			for (size_t request = threadIndex; request < requestCount; request += threadCount)
+			{
+				const WorkloadEntry& entry = workload[request % workload.size()];
+
+				chrono::steady_clock::time_point scheduled = replayStart + requestInterval * static_cast<long long>(request);
+				chrono::steady_clock::time_point convertStart = chrono::steady_clock::now();
+				if (arrivalRate > 0)
+				{
+					if (convertStart < scheduled)
+					{
+						// On time: sleep most of the wait and spin the end, then measure from the actual start
+						this_thread::sleep_until(scheduled - SPIN_WINDOW);
+						while ((convertStart = chrono::steady_clock::now()) < scheduled)
+						{
+						}
+						results.scheduleLag.record(elapsedNanoseconds(scheduled, convertStart));
+						scheduled = convertStart;
+					}
+					else
+					{
+						results.scheduleLag.record(elapsedNanoseconds(scheduled, convertStart));  // Behind: the wait counts toward total latency
+					}
+				}
+				else
+				{
+					scheduled = convertStart;
+				}
+				evaluator.setVariableValues(entry.variableValues);
+				evaluator.convertInfixToPostfix(entry.infixExpression);
+				chrono::steady_clock::time_point evaluateStart = chrono::steady_clock::now();
+				try
+				{
+					evaluator.evaluatePostfixExpression();
+				}
+				catch (const std::runtime_error&)
+				{
+					++results.failures;
+				}
+				chrono::steady_clock::time_point finished = chrono::steady_clock::now();
+
+				results.convertLatency.record(elapsedNanoseconds(convertStart, evaluateStart));
+				results.evaluateLatency.record(elapsedNanoseconds(evaluateStart, finished));
+				results.totalLatency.record(elapsedNanoseconds(scheduled, finished));
+			}
+		};
+
+	vector<thread> threads;
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		threads.emplace_back(replay, i);
+	}
+	for (thread& replayThread : threads)
+	{
+		replayThread.join();
+	}
+	double elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - replayStart).count();
+
+	ReplayResults combined;
+	for (const ReplayResults& results : threadResults)
+	{
+		combined.convertLatency.merge(results.convertLatency);
+		combined.evaluateLatency.merge(results.evaluateLatency);
+		combined.totalLatency.merge(results.totalLatency);
+		combined.scheduleLag.merge(results.scheduleLag);
+		combined.failures += results.failures;
+	}
+
+	cout << "Replayed " << requestCount << " requests from " << workload.size() << " workload entries on " << threadCount << " threads, ";
+	if (arrivalRate > 0)
+	{
+		cout << "open loop at " << arrivalRate << " requests/s" << endl;
+	}
+	else
+	{
+		cout << "closed loop" << endl;
+	}
+	cout << "Throughput: " << fixed << setprecision(0) << requestCount / elapsedSeconds << " requests/s, "
+		<< combined.failures << " evaluation failures" << endl << endl;
+
+	cout << left << setw(10) << "phase (ns)" << right << setw(12) << "p50" << setw(12) << "p99"
+		<< setw(12) << "p99.9" << setw(12) << "max" << setw(12) << "mean" << endl;
+	printLatencyRow("convert", combined.convertLatency);
+	printLatencyRow("evaluate", combined.evaluateLatency);
+	printLatencyRow("total", combined.totalLatency);
+	if (arrivalRate > 0)
+	{
+		printLatencyRow("lag", combined.scheduleLag);
+	}
+	return 0;
+}